@@ -0,0 +1,2237 @@
+/* generated by tablegen, do not edit */
+
+#include "attack_gen.h"
+#include "bitboard.h"
+#include "evaluate.h"
+
+const uint64_t knight_attacks_lookup[64] = {
+	0x0000000000020400, 0x0000000000050800, 0x00000000000A1100, 0x0000000000142200,
+	0x0000000000284400, 0x0000000000508800, 0x0000000000A01000, 0x0000000000402000,
+	0x0000000002040004, 0x0000000005080008, 0x000000000A110011, 0x0000000014220022,
+	0x0000000028440044, 0x0000000050880088, 0x00000000A0100010, 0x0000000040200020,
+	0x0000000204000402, 0x0000000508000805, 0x0000000A1100110A, 0x0000001422002214,
+	0x0000002844004428, 0x0000005088008850, 0x000000A0100010A0, 0x0000004020002040,
+	0x0000020400040200, 0x0000050800080500, 0x00000A1100110A00, 0x0000142200221400,
+	0x0000284400442800, 0x0000508800885000, 0x0000A0100010A000, 0x0000402000204000,
+	0x0002040004020000, 0x0005080008050000, 0x000A1100110A0000, 0x0014220022140000,
+	0x0028440044280000, 0x0050880088500000, 0x00A0100010A00000, 0x0040200020400000,
+	0x0204000402000000, 0x0508000805000000, 0x0A1100110A000000, 0x1422002214000000,
+	0x2844004428000000, 0x5088008850000000, 0xA0100010A0000000, 0x4020002040000000,
+	0x0400040200000000, 0x0800080500000000, 0x1100110A00000000, 0x2200221400000000,
+	0x4400442800000000, 0x8800885000000000, 0x100010A000000000, 0x2000204000000000,
+	0x0004020000000000, 0x0008050000000000, 0x00110A0000000000, 0x0022140000000000,
+	0x0044280000000000, 0x0088500000000000, 0x0010A00000000000, 0x0020400000000000,
+};
+
+const uint64_t king_attacks_lookup[64] = {
+	0x0000000000000302, 0x0000000000000705, 0x0000000000000E0A, 0x0000000000001C14,
+	0x0000000000003828, 0x0000000000007050, 0x000000000000E0A0, 0x000000000000C040,
+	0x0000000000030203, 0x0000000000070507, 0x00000000000E0A0E, 0x00000000001C141C,
+	0x0000000000382838, 0x0000000000705070, 0x0000000000E0A0E0, 0x0000000000C040C0,
+	0x0000000003020300, 0x0000000007050700, 0x000000000E0A0E00, 0x000000001C141C00,
+	0x0000000038283800, 0x0000000070507000, 0x00000000E0A0E000, 0x00000000C040C000,
+	0x0000000302030000, 0x0000000705070000, 0x0000000E0A0E0000, 0x0000001C141C0000,
+	0x0000003828380000, 0x0000007050700000, 0x000000E0A0E00000, 0x000000C040C00000,
+	0x0000030203000000, 0x0000070507000000, 0x00000E0A0E000000, 0x00001C141C000000,
+	0x0000382838000000, 0x0000705070000000, 0x0000E0A0E0000000, 0x0000C040C0000000,
+	0x0003020300000000, 0x0007050700000000, 0x000E0A0E00000000, 0x001C141C00000000,
+	0x0038283800000000, 0x0070507000000000, 0x00E0A0E000000000, 0x00C040C000000000,
+	0x0302030000000000, 0x0705070000000000, 0x0E0A0E0000000000, 0x1C141C0000000000,
+	0x3828380000000000, 0x7050700000000000, 0xE0A0E00000000000, 0xC040C00000000000,
+	0x0203000000000000, 0x0507000000000000, 0x0A0E000000000000, 0x141C000000000000,
+	0x2838000000000000, 0x5070000000000000, 0xA0E0000000000000, 0x40C0000000000000,
+};
+
+const uint64_t between_lookup[4096] = {
+	0x01010101010101FE, 0x0000000000000000, 0x0000000000000002, 0x0000000000000006,
+	0x000000000000000E, 0x000000000000001E, 0x000000000000003E, 0x000000000000007E,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000100, 0x0000000000000000, 0x0000000000000200, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000040200,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000001010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000008040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001008040200, 0x0000000000000000, 0x0000000000000000,
+	0x0000010101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000201008040200, 0x0000000000000000,
+	0x0001010101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0040201008040200,
+	0x0000000000000000, 0x02020202020202FD, 0x0000000000000000, 0x0000000000000004,
+	0x000000000000000C, 0x000000000000001C, 0x000000000000003C, 0x000000000000007C,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000200, 0x0000000000000000, 0x0000000000000400,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000080400, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000010080400, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000002010080400, 0x0000000000000000,
+	0x0000000000000000, 0x0000020202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000402010080400,
+	0x0000000000000000, 0x0002020202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000002, 0x0000000000000000, 0x04040404040404FB, 0x0000000000000000,
+	0x0000000000000008, 0x0000000000000018, 0x0000000000000038, 0x0000000000000078,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000200, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+	0x0000000000000800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000100800, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000004040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000020100800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000004020100800,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000006, 0x0000000000000004, 0x0000000000000000, 0x08080808080808F7,
+	0x0000000000000000, 0x0000000000000010, 0x0000000000000030, 0x0000000000000070,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000800,
+	0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000020400, 0x0000000000000000, 0x0000000000000000, 0x0000000000080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000201000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000008080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000040201000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000000000000E, 0x000000000000000C, 0x0000000000000008, 0x0000000000000000,
+	0x10101010101010EF, 0x0000000000000000, 0x0000000000000020, 0x0000000000000060,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000800, 0x0000000000000000,
+	0x0000000000001000, 0x0000000000000000, 0x0000000000002000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000040800, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000402000,
+	0x0000000002040800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000000000001E, 0x000000000000001C, 0x0000000000000018, 0x0000000000000010,
+	0x0000000000000000, 0x20202020202020DF, 0x0000000000000000, 0x0000000000000040,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+	0x0000000000000000, 0x0000000000002000, 0x0000000000000000, 0x0000000000004000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000081000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004081000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000204081000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020202000, 0x0000000000000000, 0x0000000000000000,
+	0x000000000000003E, 0x000000000000003C, 0x0000000000000038, 0x0000000000000030,
+	0x0000000000000020, 0x0000000000000000, 0x40404040404040BF, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000002000, 0x0000000000000000, 0x0000000000004000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000102000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000008102000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000408102000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040404000, 0x0000000000000000,
+	0x0000020408102000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040404000, 0x0000000000000000,
+	0x000000000000007E, 0x000000000000007C, 0x0000000000000078, 0x0000000000000070,
+	0x0000000000000060, 0x0000000000000040, 0x0000000000000000, 0x808080808080807F,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000004000, 0x0000000000000000, 0x0000000000008000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000204000, 0x0000000000000000, 0x0000000000000000, 0x0000000000808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010204000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000810204000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080808000,
+	0x0000000000000000, 0x0000040810204000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080808000,
+	0x0002040810204000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x010101010101FE01, 0x0000000000000000, 0x0000000000000200, 0x0000000000000600,
+	0x0000000000000E00, 0x0000000000001E00, 0x0000000000003E00, 0x0000000000007E00,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000010000, 0x0000000000000000, 0x0000000000020000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000001010000, 0x0000000000000000, 0x0000000000000000, 0x0000000004020000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000804020000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100804020000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0020100804020000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x020202020202FD02, 0x0000000000000000, 0x0000000000000400,
+	0x0000000000000C00, 0x0000000000001C00, 0x0000000000003C00, 0x0000000000007C00,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000020000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000008040000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001008040000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000201008040000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0040201008040000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000200, 0x0000000000000000, 0x040404040404FB04, 0x0000000000000000,
+	0x0000000000000800, 0x0000000000001800, 0x0000000000003800, 0x0000000000007800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000020000, 0x0000000000000000, 0x0000000000040000, 0x0000000000000000,
+	0x0000000000080000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000004040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000010080000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000002010080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000402010080000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000600, 0x0000000000000400, 0x0000000000000000, 0x080808080808F708,
+	0x0000000000000000, 0x0000000000001000, 0x0000000000003000, 0x0000000000007000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000040000, 0x0000000000000000, 0x0000000000080000,
+	0x0000000000000000, 0x0000000000100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000002040000, 0x0000000000000000, 0x0000000000000000, 0x0000000008080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000020100000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000004020100000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000E00, 0x0000000000000C00, 0x0000000000000800, 0x0000000000000000,
+	0x101010101010EF10, 0x0000000000000000, 0x0000000000002000, 0x0000000000006000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000080000, 0x0000000000000000,
+	0x0000000000100000, 0x0000000000000000, 0x0000000000200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004080000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000040200000,
+	0x0000000204080000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000001E00, 0x0000000000001C00, 0x0000000000001800, 0x0000000000001000,
+	0x0000000000000000, 0x202020202020DF20, 0x0000000000000000, 0x0000000000004000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000100000,
+	0x0000000000000000, 0x0000000000200000, 0x0000000000000000, 0x0000000000400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000008100000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000408100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020408100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000003E00, 0x0000000000003C00, 0x0000000000003800, 0x0000000000003000,
+	0x0000000000002000, 0x0000000000000000, 0x404040404040BF40, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000200000, 0x0000000000000000, 0x0000000000400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010200000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000810200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040810200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040400000, 0x0000000000000000,
+	0x0002040810200000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000007E00, 0x0000000000007C00, 0x0000000000007800, 0x0000000000007000,
+	0x0000000000006000, 0x0000000000004000, 0x0000000000000000, 0x8080808080807F80,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000400000, 0x0000000000000000, 0x0000000000800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000020400000, 0x0000000000000000, 0x0000000000000000, 0x0000000080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000001020400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000081020400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080800000,
+	0x0000000000000000, 0x0004081020400000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080800000,
+	0x0000000000000100, 0x0000000000000000, 0x0000000000000200, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0101010101FE0101, 0x0000000000000000, 0x0000000000020000, 0x0000000000060000,
+	0x00000000000E0000, 0x00000000001E0000, 0x00000000003E0000, 0x00000000007E0000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000001000000, 0x0000000000000000, 0x0000000002000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000402000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000080402000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010080402000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000200, 0x0000000000000000, 0x0000000000000400,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202020202FD0202, 0x0000000000000000, 0x0000000000040000,
+	0x00000000000C0000, 0x00000000001C0000, 0x00000000003C0000, 0x00000000007C0000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002000000, 0x0000000000000000, 0x0000000004000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000804000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100804000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0020100804000000, 0x0000000000000000,
+	0x0000000000000200, 0x0000000000000000, 0x0000000000000400, 0x0000000000000000,
+	0x0000000000000800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000020000, 0x0000000000000000, 0x0404040404FB0404, 0x0000000000000000,
+	0x0000000000080000, 0x0000000000180000, 0x0000000000380000, 0x0000000000780000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000002000000, 0x0000000000000000, 0x0000000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001008000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000201008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0040201008000000,
+	0x0000000000000000, 0x0000000000000400, 0x0000000000000000, 0x0000000000000800,
+	0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000060000, 0x0000000000040000, 0x0000000000000000, 0x0808080808F70808,
+	0x0000000000000000, 0x0000000000100000, 0x0000000000300000, 0x0000000000700000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000204000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000002010000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000402010000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000800, 0x0000000000000000,
+	0x0000000000001000, 0x0000000000000000, 0x0000000000002000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00000000000E0000, 0x00000000000C0000, 0x0000000000080000, 0x0000000000000000,
+	0x1010101010EF1010, 0x0000000000000000, 0x0000000000200000, 0x0000000000600000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0000000010000000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000408000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010000000, 0x0000000000000000, 0x0000000000000000, 0x0000004020000000,
+	0x0000020408000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001000,
+	0x0000000000000000, 0x0000000000002000, 0x0000000000000000, 0x0000000000004000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00000000001E0000, 0x00000000001C0000, 0x0000000000180000, 0x0000000000100000,
+	0x0000000000000000, 0x2020202020DF2020, 0x0000000000000000, 0x0000000000400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000000,
+	0x0000000000000000, 0x0000000020000000, 0x0000000000000000, 0x0000000040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000810000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040810000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002040810000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000002000, 0x0000000000000000, 0x0000000000004000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00000000003E0000, 0x00000000003C0000, 0x0000000000380000, 0x0000000000300000,
+	0x0000000000200000, 0x0000000000000000, 0x4040404040BF4040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000020000000, 0x0000000000000000, 0x0000000040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000001020000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000081020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004081020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000004000, 0x0000000000000000, 0x0000000000008000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00000000007E0000, 0x00000000007C0000, 0x0000000000780000, 0x0000000000700000,
+	0x0000000000600000, 0x0000000000400000, 0x0000000000000000, 0x80808080807F8080,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000040000000, 0x0000000000000000, 0x0000000080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000002040000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000102040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008102040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080000000,
+	0x0000000000010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000020400,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000010000, 0x0000000000000000, 0x0000000000020000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x01010101FE010101, 0x0000000000000000, 0x0000000002000000, 0x0000000006000000,
+	0x000000000E000000, 0x000000001E000000, 0x000000003E000000, 0x000000007E000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000100000000, 0x0000000000000000, 0x0000000200000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010100000000, 0x0000000000000000, 0x0000000000000000, 0x0000040200000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010100000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0008040200000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000040800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000020000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x02020202FD020202, 0x0000000000000000, 0x0000000004000000,
+	0x000000000C000000, 0x000000001C000000, 0x000000003C000000, 0x000000007C000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000200000000, 0x0000000000000000, 0x0000000400000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020200000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000080400000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020200000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010080400000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000081000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000020000, 0x0000000000000000, 0x0000000000040000, 0x0000000000000000,
+	0x0000000000080000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000002000000, 0x0000000000000000, 0x04040404FB040404, 0x0000000000000000,
+	0x0000000008000000, 0x0000000018000000, 0x0000000038000000, 0x0000000078000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000200000000, 0x0000000000000000, 0x0000000400000000, 0x0000000000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100800000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0020100800000000, 0x0000000000000000,
+	0x0000000000040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000102000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000040000, 0x0000000000000000, 0x0000000000080000,
+	0x0000000000000000, 0x0000000000100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000006000000, 0x0000000004000000, 0x0000000000000000, 0x08080808F7080808,
+	0x0000000000000000, 0x0000000010000000, 0x0000000030000000, 0x0000000070000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0000000800000000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020400000000, 0x0000000000000000, 0x0000000000000000, 0x0000080800000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000201000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080800000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0040201000000000,
+	0x0000000000000000, 0x0000000000080400, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000204000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000080000, 0x0000000000000000,
+	0x0000000000100000, 0x0000000000000000, 0x0000000000200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000000E000000, 0x000000000C000000, 0x0000000008000000, 0x0000000000000000,
+	0x10101010EF101010, 0x0000000000000000, 0x0000000020000000, 0x0000000060000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040800000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101000000000, 0x0000000000000000, 0x0000000000000000, 0x0000402000000000,
+	0x0002040800000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000100800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000100000,
+	0x0000000000000000, 0x0000000000200000, 0x0000000000000000, 0x0000000000400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000001E000000, 0x000000001C000000, 0x0000000018000000, 0x0000000010000000,
+	0x0000000000000000, 0x20202020DF202020, 0x0000000000000000, 0x0000000040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0000000000000000, 0x0000004000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000081000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004081000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000201000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000200000, 0x0000000000000000, 0x0000000000400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000003E000000, 0x000000003C000000, 0x0000000038000000, 0x0000000030000000,
+	0x0000000020000000, 0x0000000000000000, 0x40404040BF404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000002000000000, 0x0000000000000000, 0x0000004000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000102000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008102000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000402000, 0x0000000000000000, 0x0000000000000000, 0x0000000000808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000400000, 0x0000000000000000, 0x0000000000800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000000007E000000, 0x000000007C000000, 0x0000000078000000, 0x0000000070000000,
+	0x0000000060000000, 0x0000000040000000, 0x0000000000000000, 0x808080807F808080,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000004000000000, 0x0000000000000000, 0x0000008000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000204000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010204000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808000000000,
+	0x0000000001010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000002040800, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000001010000, 0x0000000000000000, 0x0000000000000000, 0x0000000002040000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000001000000, 0x0000000000000000, 0x0000000002000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x010101FE01010101, 0x0000000000000000, 0x0000000200000000, 0x0000000600000000,
+	0x0000000E00000000, 0x0000001E00000000, 0x0000003E00000000, 0x0000007E00000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010000000000, 0x0000000000000000, 0x0000020000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010000000000, 0x0000000000000000, 0x0000000000000000, 0x0004020000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004081000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000004080000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000002000000, 0x0000000000000000, 0x0000000004000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x020202FD02020202, 0x0000000000000000, 0x0000000400000000,
+	0x0000000C00000000, 0x0000001C00000000, 0x0000003C00000000, 0x0000007C00000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020000000000, 0x0000000000000000, 0x0000040000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0008040000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000004040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000008102000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000004040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000008100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000002000000, 0x0000000000000000, 0x0000000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000200000000, 0x0000000000000000, 0x040404FB04040404, 0x0000000000000000,
+	0x0000000800000000, 0x0000001800000000, 0x0000003800000000, 0x0000007800000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020000000000, 0x0000000000000000, 0x0000040000000000, 0x0000000000000000,
+	0x0000080000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010080000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000008080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010204000,
+	0x0000000004020000, 0x0000000000000000, 0x0000000000000000, 0x0000000008080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000010200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000600000000, 0x0000000400000000, 0x0000000000000000, 0x080808F708080808,
+	0x0000000000000000, 0x0000001000000000, 0x0000003000000000, 0x0000007000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040000000000, 0x0000000000000000, 0x0000080000000000,
+	0x0000000000000000, 0x0000100000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002040000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0020100000000000, 0x0000000000000000,
+	0x0000000008040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000008040000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000020400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0000000010000000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000E00000000, 0x0000000C00000000, 0x0000000800000000, 0x0000000000000000,
+	0x101010EF10101010, 0x0000000000000000, 0x0000002000000000, 0x0000006000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000080000000000, 0x0000000000000000,
+	0x0000100000000000, 0x0000000000000000, 0x0000200000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004080000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010100000000000, 0x0000000000000000, 0x0000000000000000, 0x0040200000000000,
+	0x0000000000000000, 0x0000000010080400, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000010080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000010000000,
+	0x0000000000000000, 0x0000000020000000, 0x0000000000000000, 0x0000000040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001E00000000, 0x0000001C00000000, 0x0000001800000000, 0x0000001000000000,
+	0x0000000000000000, 0x202020DF20202020, 0x0000000000000000, 0x0000004000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000100000000000,
+	0x0000000000000000, 0x0000200000000000, 0x0000000000000000, 0x0000400000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008100000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020200000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000020100800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000020100000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000020000000, 0x0000000000000000, 0x0000000040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000003E00000000, 0x0000003C00000000, 0x0000003800000000, 0x0000003000000000,
+	0x0000002000000000, 0x0000000000000000, 0x404040BF40404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000400000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010200000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040400000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000040201000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000080808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000040200000, 0x0000000000000000, 0x0000000000000000, 0x0000000080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000040000000, 0x0000000000000000, 0x0000000080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000007E00000000, 0x0000007C00000000, 0x0000007800000000, 0x0000007000000000,
+	0x0000006000000000, 0x0000004000000000, 0x0000000000000000, 0x8080807F80808080,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000400000000000, 0x0000000000000000, 0x0000800000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0020400000000000, 0x0000000000000000, 0x0000000000000000, 0x0080800000000000,
+	0x0000000101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000204081000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000204080000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000204000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000100000000, 0x0000000000000000, 0x0000000200000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0101FE0101010101, 0x0000000000000000, 0x0000020000000000, 0x0000060000000000,
+	0x00000E0000000000, 0x00001E0000000000, 0x00003E0000000000, 0x00007E0000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001000000000000, 0x0000000000000000, 0x0002000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000408102000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000408100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000408000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000200000000, 0x0000000000000000, 0x0000000400000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202FD0202020202, 0x0000000000000000, 0x0000040000000000,
+	0x00000C0000000000, 0x00001C0000000000, 0x00003C0000000000, 0x00007C0000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002000000000000, 0x0000000000000000, 0x0004000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000810204000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000810200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000810000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000200000000, 0x0000000000000000, 0x0000000400000000, 0x0000000000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020000000000, 0x0000000000000000, 0x0404FB0404040404, 0x0000000000000000,
+	0x0000080000000000, 0x0000180000000000, 0x0000380000000000, 0x0000780000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002000000000000, 0x0000000000000000, 0x0004000000000000, 0x0000000000000000,
+	0x0008000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000001020400000,
+	0x0000000402000000, 0x0000000000000000, 0x0000000000000000, 0x0000000808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000001020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0000000800000000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000060000000000, 0x0000040000000000, 0x0000000000000000, 0x0808F70808080808,
+	0x0000000000000000, 0x0000100000000000, 0x0000300000000000, 0x0000700000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004000000000000, 0x0000000000000000, 0x0008000000000000,
+	0x0000000000000000, 0x0010000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000804020000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000804000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000001010000000, 0x0000000000000000, 0x0000000000000000, 0x0000002040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00000E0000000000, 0x00000C0000000000, 0x0000080000000000, 0x0000000000000000,
+	0x1010EF1010101010, 0x0000000000000000, 0x0000200000000000, 0x0000600000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008000000000000, 0x0000000000000000,
+	0x0010000000000000, 0x0000000000000000, 0x0020000000000000, 0x0000000000000000,
+	0x0000001008040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001008040000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000001008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000002020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0000000000000000, 0x0000004000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00001E0000000000, 0x00001C0000000000, 0x0000180000000000, 0x0000100000000000,
+	0x0000000000000000, 0x2020DF2020202020, 0x0000000000000000, 0x0000400000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010000000000000,
+	0x0000000000000000, 0x0020000000000000, 0x0000000000000000, 0x0040000000000000,
+	0x0000000000000000, 0x0000002010080400, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000002010080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000002010000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000002000000000, 0x0000000000000000, 0x0000004000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00003E0000000000, 0x00003C0000000000, 0x0000380000000000, 0x0000300000000000,
+	0x0000200000000000, 0x0000000000000000, 0x4040BF4040404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0020000000000000, 0x0000000000000000, 0x0040000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000004020100800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000004020100000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000004020000000, 0x0000000000000000, 0x0000000000000000, 0x0000008080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000004000000000, 0x0000000000000000, 0x0000008000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x00007E0000000000, 0x00007C0000000000, 0x0000780000000000, 0x0000700000000000,
+	0x0000600000000000, 0x0000400000000000, 0x0000000000000000, 0x80807F8080808080,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0040000000000000, 0x0000000000000000, 0x0080000000000000,
+	0x0000010101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000020408102000, 0x0000000000000000,
+	0x0000010101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020408100000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020408000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010100000000, 0x0000000000000000, 0x0000000000000000, 0x0000020400000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000010000000000, 0x0000000000000000, 0x0000020000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x01FE010101010101, 0x0000000000000000, 0x0002000000000000, 0x0006000000000000,
+	0x000E000000000000, 0x001E000000000000, 0x003E000000000000, 0x007E000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000040810204000,
+	0x0000000000000000, 0x0000020202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040810200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040810000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020200000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000040800000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000020000000000, 0x0000000000000000, 0x0000040000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x02FD020202020202, 0x0000000000000000, 0x0004000000000000,
+	0x000C000000000000, 0x001C000000000000, 0x003C000000000000, 0x007C000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000081020400000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000081020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000040400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000081000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000020000000000, 0x0000000000000000, 0x0000040000000000, 0x0000000000000000,
+	0x0000080000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002000000000000, 0x0000000000000000, 0x04FB040404040404, 0x0000000000000000,
+	0x0008000000000000, 0x0018000000000000, 0x0038000000000000, 0x0078000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000080808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000102040000000,
+	0x0000040200000000, 0x0000000000000000, 0x0000000000000000, 0x0000080800000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000102000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040000000000, 0x0000000000000000, 0x0000080000000000,
+	0x0000000000000000, 0x0000100000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0006000000000000, 0x0004000000000000, 0x0000000000000000, 0x08F7080808080808,
+	0x0000000000000000, 0x0010000000000000, 0x0030000000000000, 0x0070000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000080402000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101010000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000080400000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000101000000000, 0x0000000000000000, 0x0000000000000000, 0x0000204000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000080000000000, 0x0000000000000000,
+	0x0000100000000000, 0x0000000000000000, 0x0000200000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x000E000000000000, 0x000C000000000000, 0x0008000000000000, 0x0000000000000000,
+	0x10EF101010101010, 0x0000000000000000, 0x0020000000000000, 0x0060000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000100804020000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100804000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000100800000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000202000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000100000000000,
+	0x0000000000000000, 0x0000200000000000, 0x0000000000000000, 0x0000400000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x001E000000000000, 0x001C000000000000, 0x0018000000000000, 0x0010000000000000,
+	0x0000000000000000, 0x20DF202020202020, 0x0000000000000000, 0x0040000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000201008040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000201008040000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000201008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000201000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000404000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000400000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x003E000000000000, 0x003C000000000000, 0x0038000000000000, 0x0030000000000000,
+	0x0020000000000000, 0x0000000000000000, 0x40BF404040404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000402010080400, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080808000,
+	0x0000000000000000, 0x0000000000000000, 0x0000402010080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000402010000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000402000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000400000000000, 0x0000000000000000, 0x0000800000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x007E000000000000, 0x007C000000000000, 0x0078000000000000, 0x0070000000000000,
+	0x0060000000000000, 0x0040000000000000, 0x0000000000000000, 0x807F808080808080,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010101010100, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0002040810204000,
+	0x0001010101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0002040810200000, 0x0000000000000000,
+	0x0001010101000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002040810000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010100000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002040800000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001010000000000, 0x0000000000000000, 0x0000000000000000, 0x0002040000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0001000000000000, 0x0000000000000000, 0x0002000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0xFE01010101010101, 0x0000000000000000, 0x0200000000000000, 0x0600000000000000,
+	0x0E00000000000000, 0x1E00000000000000, 0x3E00000000000000, 0x7E00000000000000,
+	0x0000000000000000, 0x0002020202020200, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020202020000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0004081020400000,
+	0x0000000000000000, 0x0002020202000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004081020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020200000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004081000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0004080000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002000000000000, 0x0000000000000000, 0x0004000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0xFD02020202020202, 0x0000000000000000, 0x0400000000000000,
+	0x0C00000000000000, 0x1C00000000000000, 0x3C00000000000000, 0x7C00000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404040400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040404000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008102040000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008102000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0004040000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0008100000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0002000000000000, 0x0000000000000000, 0x0004000000000000, 0x0000000000000000,
+	0x0008000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0200000000000000, 0x0000000000000000, 0xFB04040404040404, 0x0000000000000000,
+	0x0800000000000000, 0x1800000000000000, 0x3800000000000000, 0x7800000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808080800,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808080000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080808000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080800000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010204000000000,
+	0x0004020000000000, 0x0000000000000000, 0x0000000000000000, 0x0008080000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0010200000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004000000000000, 0x0000000000000000, 0x0008000000000000,
+	0x0000000000000000, 0x0010000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0600000000000000, 0x0400000000000000, 0x0000000000000000, 0xF708080808080808,
+	0x0000000000000000, 0x1000000000000000, 0x3000000000000000, 0x7000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010101000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010100000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101010000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0008040200000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010101000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0008040000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0010100000000000, 0x0000000000000000, 0x0000000000000000, 0x0020400000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0008000000000000, 0x0000000000000000,
+	0x0010000000000000, 0x0000000000000000, 0x0020000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0E00000000000000, 0x0C00000000000000, 0x0800000000000000, 0x0000000000000000,
+	0xEF10101010101010, 0x0000000000000000, 0x2000000000000000, 0x6000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020202000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020200000, 0x0000000000000000, 0x0000000000000000,
+	0x0010080402000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202020000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010080400000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020202000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0010080000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020200000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0010000000000000,
+	0x0000000000000000, 0x0020000000000000, 0x0000000000000000, 0x0040000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x1E00000000000000, 0x1C00000000000000, 0x1800000000000000, 0x1000000000000000,
+	0x0000000000000000, 0xDF20202020202020, 0x0000000000000000, 0x4000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040404000, 0x0000000000000000,
+	0x0020100804020000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040400000, 0x0000000000000000,
+	0x0000000000000000, 0x0020100804000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404040000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0020100800000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040404000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0020100000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0040400000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0020000000000000, 0x0000000000000000, 0x0040000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x3E00000000000000, 0x3C00000000000000, 0x3800000000000000, 0x3000000000000000,
+	0x2000000000000000, 0x0000000000000000, 0xBF40404040404040, 0x0000000000000000,
+	0x0040201008040200, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080808000,
+	0x0000000000000000, 0x0040201008040000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080800000,
+	0x0000000000000000, 0x0000000000000000, 0x0040201008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808080000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0040201000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0080808000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0040200000000000, 0x0000000000000000, 0x0000000000000000, 0x0080800000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0040000000000000, 0x0000000000000000, 0x0080000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+	0x7E00000000000000, 0x7C00000000000000, 0x7800000000000000, 0x7000000000000000,
+	0x6000000000000000, 0x4000000000000000, 0x0000000000000000, 0x7F80808080808080,
+};
+
+const uint64_t line_lookup[4096] = {
+	0x01010101010101FE, 0x00000000000000FC, 0x00000000000000FA, 0x00000000000000F6,
+	0x00000000000000EE, 0x00000000000000DE, 0x00000000000000BE, 0x000000000000007E,
+	0x0101010101010000, 0x8040201008040000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x0000001000000000,
+	0x0101010101000100, 0x0000000000000000, 0x8040201008000200, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0x0101010100010100, 0x0000000000040000, 0x0000000000000000, 0x8040201000040200,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000200000000000,
+	0x0101010001010100, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x8040200008040200, 0x0000000000000000, 0x0000200000000000, 0x0000000000000000,
+	0x0101000101010100, 0x0000000008000000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x8040001008040200, 0x0000000000000000, 0x0040000000000000,
+	0x0100010101010100, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x8000201008040200, 0x0000000000000000,
+	0x0001010101010100, 0x0000001000000000, 0x0000000000000000, 0x0000200000000000,
+	0x0000000000000000, 0x0040000000000000, 0x0000000000000000, 0x0040201008040200,
+	0x00000000000000FC, 0x02020202020202FD, 0x00000000000000F9, 0x00000000000000F5,
+	0x00000000000000ED, 0x00000000000000DD, 0x00000000000000BD, 0x000000000000007D,
+	0x0000000000000000, 0x0202020202020000, 0x0080402010080000, 0x0000000000000000,
+	0x0000000000080000, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202020202000200, 0x0000000000000000, 0x0080402010000400,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000002000000000,
+	0x0000000000000400, 0x0202020200020200, 0x0000000000080100, 0x0000000000000000,
+	0x0080402000080400, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202020002020200, 0x0000000000000000, 0x0000000010000100,
+	0x0000000000000000, 0x0080400010080400, 0x0000000000000000, 0x0000400000000000,
+	0x0000000000080000, 0x0202000202020200, 0x0000000010000000, 0x0000000000000000,
+	0x0000002000000100, 0x0000000000000000, 0x0080002010080400, 0x0000000000000000,
+	0x0000000000000000, 0x0200020202020200, 0x0000000000000000, 0x0000002000000000,
+	0x0000000000000000, 0x0000400000000100, 0x0000000000000000, 0x0000402010080400,
+	0x0000000010000000, 0x0002020202020200, 0x0000002000000000, 0x0000000000000000,
+	0x0000400000000000, 0x0000000000000000, 0x0080000000000100, 0x0000000000000000,
+	0x00000000000000FA, 0x00000000000000F9, 0x04040404040404FB, 0x00000000000000F3,
+	0x00000000000000EB, 0x00000000000000DB, 0x00000000000000BB, 0x000000000000007B,
+	0x0000000000000000, 0x0000000000010000, 0x0404040404040000, 0x0000804020100000,
+	0x0000000000000000, 0x0000000000100000, 0x0000000000000000, 0x0000000020000000,
+	0x0000000000000200, 0x0000000000000000, 0x0404040404000400, 0x0000000000000000,
+	0x0000804020000800, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000010800, 0x0404040400040400, 0x0000000000100200,
+	0x0000000000000000, 0x0000804000100800, 0x0000000000000000, 0x0000004000000000,
+	0x0000000000000800, 0x0000000000000000, 0x0404040004040400, 0x0000000000000000,
+	0x0000000020000200, 0x0000000000000000, 0x0000800020100800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000100000, 0x0404000404040400, 0x0000000020010000,
+	0x0000000000000000, 0x0000004000000200, 0x0000000000000000, 0x0000004020100800,
+	0x0000000000100000, 0x0000000000000000, 0x0400040404040400, 0x0000000000000000,
+	0x0000004000010000, 0x0000000000000000, 0x0000800000000200, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020000000, 0x0004040404040400, 0x0000004000000000,
+	0x0000000000000000, 0x0000800000010000, 0x0000000000000000, 0x0000000000000200,
+	0x00000000000000F6, 0x00000000000000F5, 0x00000000000000F3, 0x08080808080808F7,
+	0x00000000000000E7, 0x00000000000000D7, 0x00000000000000B7, 0x0000000000000077,
+	0x0000000000020000, 0x0000000000000000, 0x0000000001020000, 0x0808080808080000,
+	0x0000008040200000, 0x0000000000000000, 0x0000000000200000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000001000400, 0x0000000000000000, 0x0808080808000800,
+	0x0000000000000000, 0x0000008040001000, 0x0000000000000000, 0x0000000040000000,
+	0x0000000000020400, 0x0000000000000000, 0x0000000000021000, 0x0808080800080800,
+	0x0000000000200400, 0x0000000000000000, 0x0000008000201000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000001001000, 0x0000000000000000, 0x0808080008080800,
+	0x0000000000000000, 0x0000000040000400, 0x0000000000000000, 0x0000000040201000,
+	0x0000000000001000, 0x0000000000000000, 0x0000000001200000, 0x0808000808080800,
+	0x0000000040020000, 0x0000000000000000, 0x0000008000000400, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000200000, 0x0000000000000000, 0x0800080808080800,
+	0x0000000000000000, 0x0000008000020000, 0x0000000000000000, 0x0000000000000400,
+	0x0000000000200000, 0x0000000000000000, 0x0000000040000000, 0x0008080808080800,
+	0x0000008001000000, 0x0000000000000000, 0x0000000000020000, 0x0000000000000000,
+	0x00000000000000EE, 0x00000000000000ED, 0x00000000000000EB, 0x00000000000000E7,
+	0x10101010101010EF, 0x00000000000000CF, 0x00000000000000AF, 0x000000000000006F,
+	0x0000000000000000, 0x0000000000040000, 0x0000000000000000, 0x0000000102040000,
+	0x1010101010100000, 0x0000000080400000, 0x0000000000000000, 0x0000000000400000,
+	0x0000000002000000, 0x0000000000000000, 0x0000000102000800, 0x0000000000000000,
+	0x1010101010001000, 0x0000000000000000, 0x0000000080002000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000100040800, 0x0000000000000000, 0x0000000000042000,
+	0x1010101000101000, 0x0000000000400800, 0x0000000000000000, 0x0000000000402000,
+	0x0000000002040800, 0x0000000000000000, 0x0000000002002000, 0x0000000000000000,
+	0x1010100010101000, 0x0000000000000000, 0x0000000080000800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000100002000, 0x0000000000000000, 0x0000000002400000,
+	0x1010001010101000, 0x0000000080040000, 0x0000000000000000, 0x0000000000000800,
+	0x0000000000002000, 0x0000000000000000, 0x0000000100400000, 0x0000000000000000,
+	0x1000101010101000, 0x0000000000000000, 0x0000000000040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000000400000, 0x0000000000000000, 0x0000000180000000,
+	0x0010101010101000, 0x0000000002000000, 0x0000000000000000, 0x0000000000040000,
+	0x00000000000000DE, 0x00000000000000DD, 0x00000000000000DB, 0x00000000000000D7,
+	0x00000000000000CF, 0x20202020202020DF, 0x000000000000009F, 0x000000000000005F,
+	0x0000000004000000, 0x0000000000000000, 0x0000000000080000, 0x0000000000000000,
+	0x0000010204080000, 0x2020202020200000, 0x0000000000800000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000010204001000,
+	0x0000000000000000, 0x2020202020002000, 0x0000000000000000, 0x0000000000004000,
+	0x0000000200000000, 0x0000000000000000, 0x0000010200081000, 0x0000000000000000,
+	0x0000000000084000, 0x2020202000202000, 0x0000000000801000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010004081000, 0x0000000000000000, 0x0000000004004000,
+	0x0000000000000000, 0x2020200020202000, 0x0000000000000000, 0x0000000000001000,
+	0x0000000204081000, 0x0000000000000000, 0x0000000200004000, 0x0000000000000000,
+	0x0000000004800000, 0x2020002020202000, 0x0000000000080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010000004000, 0x0000000000000000, 0x0000000200800000,
+	0x0000000000000000, 0x2000202020202000, 0x0000000000000000, 0x0000000000080000,
+	0x0000000000004000, 0x0000000000000000, 0x0000010000800000, 0x0000000000000000,
+	0x0000000200000000, 0x0020202020202000, 0x0000000004000000, 0x0000000000000000,
+	0x00000000000000BE, 0x00000000000000BD, 0x00000000000000BB, 0x00000000000000B7,
+	0x00000000000000AF, 0x000000000000009F, 0x40404040404040BF, 0x000000000000003F,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x0000000000100000,
+	0x0000000000000000, 0x0001020408100000, 0x4040404040400000, 0x0000000000000000,
+	0x0000000400000000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0001020408002000, 0x0000000000000000, 0x4040404040004000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0001020400102000,
+	0x0000000000000000, 0x0000000000108000, 0x4040404000404000, 0x0000000000002000,
+	0x0000020000000000, 0x0000000000000000, 0x0001020008102000, 0x0000000000000000,
+	0x0000000008008000, 0x0000000000000000, 0x4040400040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000408102000, 0x0000000000000000, 0x0000000400008000,
+	0x0000000000000000, 0x0000000008000000, 0x4040004040404000, 0x0000000000100000,
+	0x0000020408102000, 0x0000000000000000, 0x0000020000008000, 0x0000000000000000,
+	0x0000000400000000, 0x0000000000000000, 0x4000404040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000000008000, 0x0000000000000000, 0x0000020000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0040404040404000, 0x0000000008000000,
+	0x000000000000007E, 0x000000000000007D, 0x000000000000007B, 0x0000000000000077,
+	0x000000000000006F, 0x000000000000005F, 0x000000000000003F, 0x808080808080807F,
+	0x0000000800000000, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x0000000000200000, 0x0000000000000000, 0x0102040810200000, 0x8080808080800000,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x0000000010000000,
+	0x0000000000000000, 0x0102040810004000, 0x0000000000000000, 0x8080808080008000,
+	0x0000040000000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0102040800204000, 0x0000000000000000, 0x0000000000200000, 0x8080808000808000,
+	0x0000000000000000, 0x0000040000000000, 0x0000000000000000, 0x0102040010204000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x8080800080808000,
+	0x0002000000000000, 0x0000000000000000, 0x0102000810204000, 0x0000000000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0000000010000000, 0x8080008080808000,
+	0x0000000000000000, 0x0100040810204000, 0x0000000000000000, 0x0000040000000000,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x8000808080808000,
+	0x0002040810204000, 0x0000000000000000, 0x0002000000000000, 0x0000000000000000,
+	0x0000040000000000, 0x0000000000000000, 0x0000000800000000, 0x0080808080808000,
+	0x0101010101010000, 0x0000000000000000, 0x0000000000000000, 0x0000000000020000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000000800000000,
+	0x010101010101FE01, 0x000000000000FC00, 0x000000000000FA00, 0x000000000000F600,
+	0x000000000000EE00, 0x000000000000DE00, 0x000000000000BE00, 0x0000000000007E00,
+	0x0101010101000001, 0x4020100804000000, 0x0000000000000000, 0x0000000004000002,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x0000100000000000,
+	0x0101010100010001, 0x0000000000000000, 0x4020100800020000, 0x0000000000000000,
+	0x0000000800000002, 0x0000000000000000, 0x0000100000000000, 0x0000000000000000,
+	0x0101010001010001, 0x0000000004000000, 0x0000000000000000, 0x4020100004020000,
+	0x0000000000000000, 0x0000100000000002, 0x0000000000000000, 0x0020000000000000,
+	0x0101000101010001, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x4020000804020000, 0x0000000000000000, 0x0020000000000002, 0x0000000000000000,
+	0x0100010101010001, 0x0000000800000000, 0x0000000000000000, 0x0000100000000000,
+	0x0000000000000000, 0x4000100804020000, 0x0000000000000000, 0x4000000000000002,
+	0x0001010101010001, 0x0000000000000000, 0x0000100000000000, 0x0000000000000000,
+	0x0020000000000000, 0x0000000000000000, 0x0020100804020000, 0x0000000000000000,
+	0x8040201008040000, 0x0202020202020000, 0x0000000000010000, 0x0000000000000000,
+	0x0000000000040000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x000000000000FC00, 0x020202020202FD02, 0x000000000000F900, 0x000000000000F500,
+	0x000000000000ED00, 0x000000000000DD00, 0x000000000000BD00, 0x0000000000007D00,
+	0x0000000000000004, 0x0202020202000002, 0x8040201008000001, 0x0000000000000000,
+	0x0000000008000004, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202020200020002, 0x0000000000000000, 0x8040201000040001,
+	0x0000000000000000, 0x0000001000000004, 0x0000000000000000, 0x0000200000000000,
+	0x0000000000040000, 0x0202020002020002, 0x0000000008010000, 0x0000000000000000,
+	0x8040200008040001, 0x0000000000000000, 0x0000200000000004, 0x0000000000000000,
+	0x0000000000000000, 0x0202000202020002, 0x0000000000000000, 0x0000001000010000,
+	0x0000000000000000, 0x8040001008040001, 0x0000000000000000, 0x0040000000000004,
+	0x0000000008000000, 0x0200020202020002, 0x0000001000000000, 0x0000000000000000,
+	0x0000200000010000, 0x0000000000000000, 0x8000201008040001, 0x0000000000000000,
+	0x0000000000000000, 0x0002020202020002, 0x0000000000000000, 0x0000200000000000,
+	0x0000000000000000, 0x0040000000010000, 0x0000000000000000, 0x0040201008040001,
+	0x0000000000000000, 0x0080402010080000, 0x0404040404040000, 0x0000000001020000,
+	0x0000000000000000, 0x0000000000080000, 0x0000000000000000, 0x0000000010000000,
+	0x000000000000FA00, 0x000000000000F900, 0x040404040404FB04, 0x000000000000F300,
+	0x000000000000EB00, 0x000000000000DB00, 0x000000000000BB00, 0x0000000000007B00,
+	0x0000000000000000, 0x0000000001000008, 0x0404040404000004, 0x0080402010000002,
+	0x0000000000000000, 0x0000000010000008, 0x0000000000000000, 0x0000002000000000,
+	0x0000000000020008, 0x0000000000000000, 0x0404040400040004, 0x0000000000000000,
+	0x0080402000080002, 0x0000000000000000, 0x0000002000000008, 0x0000000000000000,
+	0x0000000000000000, 0x0000000001080000, 0x0404040004040004, 0x0000000010020000,
+	0x0000000000000000, 0x0080400010080002, 0x0000000000000000, 0x0000400000000008,
+	0x0000000000080000, 0x0000000000000000, 0x0404000404040004, 0x0000000000000000,
+	0x0000002000020000, 0x0000000000000000, 0x0080002010080002, 0x0000000000000000,
+	0x0000000000000000, 0x0000000010000000, 0x0400040404040004, 0x0000002001000000,
+	0x0000000000000000, 0x0000400000020000, 0x0000000000000000, 0x0000402010080002,
+	0x0000000010000000, 0x0000000000000000, 0x0004040404040004, 0x0000000000000000,
+	0x0000400001000000, 0x0000000000000000, 0x0080000000020000, 0x0000000000000000,
+	0x0000000000040000, 0x0000000000000000, 0x0000804020100000, 0x0808080808080000,
+	0x0000000102040000, 0x0000000000000000, 0x0000000000100000, 0x0000000000000000,
+	0x000000000000F600, 0x000000000000F500, 0x000000000000F300, 0x080808080808F708,
+	0x000000000000E700, 0x000000000000D700, 0x000000000000B700, 0x0000000000007700,
+	0x0000000002000004, 0x0000000000000000, 0x0000000102000010, 0x0808080808000008,
+	0x0000804020000004, 0x0000000000000000, 0x0000000020000010, 0x0000000000000000,
+	0x0000000000000000, 0x0000000100040010, 0x0000000000000000, 0x0808080800080008,
+	0x0000000000000000, 0x0000804000100004, 0x0000000000000000, 0x0000004000000010,
+	0x0000000002040010, 0x0000000000000000, 0x0000000002100000, 0x0808080008080008,
+	0x0000000020040000, 0x0000000000000000, 0x0000800020100004, 0x0000000000000000,
+	0x0000000000000000, 0x0000000100100000, 0x0000000000000000, 0x0808000808080008,
+	0x0000000000000000, 0x0000004000040000, 0x0000000000000000, 0x0000004020100004,
+	0x0000000000100000, 0x0000000000000000, 0x0000000120000000, 0x0800080808080008,
+	0x0000004002000000, 0x0000000000000000, 0x0000800000040000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020000000, 0x0000000000000000, 0x0008080808080008,
+	0x0000000000000000, 0x0000800002000000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000000080000, 0x0000000000000000, 0x0000008040200000,
+	0x1010101010100000, 0x0000010204080000, 0x0000000000000000, 0x0000000000200000,
+	0x000000000000EE00, 0x000000000000ED00, 0x000000000000EB00, 0x000000000000E700,
+	0x101010101010EF10, 0x000000000000CF00, 0x000000000000AF00, 0x0000000000006F00,
+	0x0000000000000000, 0x0000000004000008, 0x0000000000000000, 0x0000010204000020,
+	0x1010101010000010, 0x0000008040000008, 0x0000000000000000, 0x0000000040000020,
+	0x0000000200000008, 0x0000000000000000, 0x0000010200080020, 0x0000000000000000,
+	0x1010101000100010, 0x0000000000000000, 0x0000008000200008, 0x0000000000000000,
+	0x0000000000000000, 0x0000010004080020, 0x0000000000000000, 0x0000000004200000,
+	0x1010100010100010, 0x0000000040080000, 0x0000000000000000, 0x0000000040200008,
+	0x0000000204080020, 0x0000000000000000, 0x0000000200200000, 0x0000000000000000,
+	0x1010001010100010, 0x0000000000000000, 0x0000008000080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010000200000, 0x0000000000000000, 0x0000000240000000,
+	0x1000101010100010, 0x0000008004000000, 0x0000000000000000, 0x0000000000080000,
+	0x0000000000200000, 0x0000000000000000, 0x0000010040000000, 0x0000000000000000,
+	0x0010101010100010, 0x0000000000000000, 0x0000000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000000000100000, 0x0000000000000000,
+	0x0000000080400000, 0x2020202020200000, 0x0001020408100000, 0x0000000000000000,
+	0x000000000000DE00, 0x000000000000DD00, 0x000000000000DB00, 0x000000000000D700,
+	0x000000000000CF00, 0x202020202020DF20, 0x0000000000009F00, 0x0000000000005F00,
+	0x0000000400000000, 0x0000000000000000, 0x0000000008000010, 0x0000000000000000,
+	0x0001020408000040, 0x2020202020000020, 0x0000000080000010, 0x0000000000000000,
+	0x0000000000000000, 0x0000000400000010, 0x0000000000000000, 0x0001020400100040,
+	0x0000000000000000, 0x2020202000200020, 0x0000000000000000, 0x0000000000400010,
+	0x0000020000000010, 0x0000000000000000, 0x0001020008100040, 0x0000000000000000,
+	0x0000000008400000, 0x2020200020200020, 0x0000000080100000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000408100040, 0x0000000000000000, 0x0000000400400000,
+	0x0000000000000000, 0x2020002020200020, 0x0000000000000000, 0x0000000000100000,
+	0x0000020408100040, 0x0000000000000000, 0x0000020000400000, 0x0000000000000000,
+	0x0000000480000000, 0x2000202020200020, 0x0000000008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000000400000, 0x0000000000000000, 0x0000020080000000,
+	0x0000000000000000, 0x0020202020200020, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000000000200000,
+	0x0000000000000000, 0x0000000000800000, 0x4040404040400000, 0x0102040810200000,
+	0x000000000000BE00, 0x000000000000BD00, 0x000000000000BB00, 0x000000000000B700,
+	0x000000000000AF00, 0x0000000000009F00, 0x404040404040BF40, 0x0000000000003F00,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x0000000010000020,
+	0x0000000000000000, 0x0102040810000080, 0x4040404040000040, 0x0000000000000020,
+	0x0000040000000000, 0x0000000000000000, 0x0000000800000020, 0x0000000000000000,
+	0x0102040800200080, 0x0000000000000000, 0x4040404000400040, 0x0000000000000000,
+	0x0000000000000000, 0x0000040000000020, 0x0000000000000000, 0x0102040010200080,
+	0x0000000000000000, 0x0000000010800000, 0x4040400040400040, 0x0000000000200000,
+	0x0002000000000020, 0x0000000000000000, 0x0102000810200080, 0x0000000000000000,
+	0x0000000800800000, 0x0000000000000000, 0x4040004040400040, 0x0000000000000000,
+	0x0000000000000000, 0x0100040810200080, 0x0000000000000000, 0x0000040000800000,
+	0x0000000000000000, 0x0000000800000000, 0x4000404040400040, 0x0000000010000000,
+	0x0002040810200080, 0x0000000000000000, 0x0002000000800000, 0x0000000000000000,
+	0x0000040000000000, 0x0000000000000000, 0x0040404040400040, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000400000, 0x0000000000000000, 0x0000000000000000, 0x8080808080800000,
+	0x0000000000007E00, 0x0000000000007D00, 0x0000000000007B00, 0x0000000000007700,
+	0x0000000000006F00, 0x0000000000005F00, 0x0000000000003F00, 0x8080808080807F80,
+	0x0000080000000000, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0x0000000020000040, 0x0000000000000000, 0x0204081020000000, 0x8080808080000080,
+	0x0000000000000000, 0x0000080000000000, 0x0000000000000000, 0x0000001000000040,
+	0x0000000000000000, 0x0204081000400000, 0x0000000000000000, 0x8080808000800080,
+	0x0004000000000000, 0x0000000000000000, 0x0000080000000040, 0x0000000000000000,
+	0x0204080020400000, 0x0000000000000000, 0x0000000020000000, 0x8080800080800080,
+	0x0000000000000000, 0x0004000000000040, 0x0000000000000000, 0x0204001020400000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x8080008080800080,
+	0x0200000000000040, 0x0000000000000000, 0x0200081020400000, 0x0000000000000000,
+	0x0000080000000000, 0x0000000000000000, 0x0000001000000000, 0x8000808080800080,
+	0x0000000000000000, 0x0004081020400000, 0x0000000000000000, 0x0004000000000000,
+	0x0000000000000000, 0x0000080000000000, 0x0000000000000000, 0x0080808080800080,
+	0x0101010101000100, 0x0000000000000000, 0x0000000000000200, 0x0000000000000000,
+	0x0000000002000000, 0x0000000000000000, 0x0000000400000000, 0x0000000000000000,
+	0x0101010101000001, 0x0000000000000004, 0x0000000000000000, 0x0000000002000004,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0000080000000000,
+	0x0101010101FE0101, 0x0000000000FC0000, 0x0000000000FA0000, 0x0000000000F60000,
+	0x0000000000EE0000, 0x0000000000DE0000, 0x0000000000BE0000, 0x00000000007E0000,
+	0x0101010100000101, 0x2010080400000000, 0x0000000000000000, 0x0000000400000200,
+	0x0000000000000000, 0x0000080000000004, 0x0000000000000000, 0x0010000000000000,
+	0x0101010001000101, 0x0000000000000000, 0x2010080002000000, 0x0000000000000000,
+	0x0000080000000200, 0x0000000000000000, 0x0010000000000004, 0x0000000000000000,
+	0x0101000101000101, 0x0000000400000000, 0x0000000000000000, 0x2010000402000000,
+	0x0000000000000000, 0x0010000000000200, 0x0000000000000000, 0x2000000000000004,
+	0x0100010101000101, 0x0000000000000000, 0x0000080000000000, 0x0000000000000000,
+	0x2000080402000000, 0x0000000000000000, 0x2000000000000200, 0x0000000000000000,
+	0x0001010101000101, 0x0000080000000000, 0x0000000000000000, 0x0010000000000000,
+	0x0000000000000000, 0x0010080402000000, 0x0000000000000000, 0x0000000000000200,
+	0x0000000000000000, 0x0202020202000200, 0x0000000000000000, 0x0000000001000400,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000000800000000,
+	0x4020100804000000, 0x0202020202000002, 0x0000000001000008, 0x0000000000000000,
+	0x0000000004000008, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0000000000FC0000, 0x0202020202FD0202, 0x0000000000F90000, 0x0000000000F50000,
+	0x0000000000ED0000, 0x0000000000DD0000, 0x0000000000BD0000, 0x00000000007D0000,
+	0x0000000000000408, 0x0202020200000202, 0x4020100800000100, 0x0000000000000000,
+	0x0000000800000400, 0x0000000000000000, 0x0000100000000008, 0x0000000000000000,
+	0x0000000000000000, 0x0202020002000202, 0x0000000000000000, 0x4020100004000100,
+	0x0000000000000000, 0x0000100000000400, 0x0000000000000000, 0x0020000000000008,
+	0x0000000004000000, 0x0202000202000202, 0x0000000801000000, 0x0000000000000000,
+	0x4020000804000100, 0x0000000000000000, 0x0020000000000400, 0x0000000000000000,
+	0x0000000000000000, 0x0200020202000202, 0x0000000000000000, 0x0000100001000000,
+	0x0000000000000000, 0x4000100804000100, 0x0000000000000000, 0x4000000000000400,
+	0x0000000800000000, 0x0002020202000202, 0x0000100000000000, 0x0000000000000000,
+	0x0020000001000000, 0x0000000000000000, 0x0020100804000100, 0x0000000000000000,
+	0x8040201008000200, 0x0000000000000000, 0x0404040404000400, 0x0000000000000000,
+	0x0000000102000800, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0000000000000000, 0x8040201008000001, 0x0404040404000004, 0x0000000102000010,
+	0x0000000000000000, 0x0000000008000010, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000FA0000, 0x0000000000F90000, 0x0404040404FB0404, 0x0000000000F30000,
+	0x0000000000EB0000, 0x0000000000DB0000, 0x0000000000BB0000, 0x00000000007B0000,
+	0x0000000000000000, 0x0000000100000810, 0x0404040400000404, 0x8040201000000201,
+	0x0000000000000000, 0x0000001000000800, 0x0000000000000000, 0x0000200000000010,
+	0x0000000002000810, 0x0000000000000000, 0x0404040004000404, 0x0000000000000000,
+	0x8040200008000201, 0x0000000000000000, 0x0000200000000800, 0x0000000000000000,
+	0x0000000000000000, 0x0000000108000000, 0x0404000404000404, 0x0000001002000000,
+	0x0000000000000000, 0x8040001008000201, 0x0000000000000000, 0x0040000000000800,
+	0x0000000008000000, 0x0000000000000000, 0x0400040404000404, 0x0000000000000000,
+	0x0000200002000000, 0x0000000000000000, 0x8000201008000201, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000000000, 0x0004040404000404, 0x0000200100000000,
+	0x0000000000000000, 0x0040000002000000, 0x0000000000000000, 0x0040201008000201,
+	0x0000000000000000, 0x0080402010000400, 0x0000000000000000, 0x0808080808000800,
+	0x0000000000000000, 0x0000010204001000, 0x0000000000000000, 0x0000000010000000,
+	0x0000000004000002, 0x0000000000000000, 0x0080402010000002, 0x0808080808000008,
+	0x0000010204000020, 0x0000000000000000, 0x0000000010000020, 0x0000000000000000,
+	0x0000000000F60000, 0x0000000000F50000, 0x0000000000F30000, 0x0808080808F70808,
+	0x0000000000E70000, 0x0000000000D70000, 0x0000000000B70000, 0x0000000000770000,
+	0x0000000200000400, 0x0000000000000000, 0x0000010200001020, 0x0808080800000808,
+	0x0080402000000402, 0x0000000000000000, 0x0000002000001000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010004001020, 0x0000000000000000, 0x0808080008000808,
+	0x0000000000000000, 0x0080400010000402, 0x0000000000000000, 0x0000400000001000,
+	0x0000000204001020, 0x0000000000000000, 0x0000000210000000, 0x0808000808000808,
+	0x0000002004000000, 0x0000000000000000, 0x0080002010000402, 0x0000000000000000,
+	0x0000000000000000, 0x0000010010000000, 0x0000000000000000, 0x0800080808000808,
+	0x0000000000000000, 0x0000400004000000, 0x0000000000000000, 0x0000402010000402,
+	0x0000000010000000, 0x0000000000000000, 0x0000012000000000, 0x0008080808000808,
+	0x0000400200000000, 0x0000000000000000, 0x0080000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000804020000800, 0x0000000000000000,
+	0x1010101010001000, 0x0000000000000000, 0x0001020408002000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000008000004, 0x0000000000000000, 0x0000804020000004,
+	0x1010101010000010, 0x0001020408000040, 0x0000000000000000, 0x0000000020000040,
+	0x0000000000EE0000, 0x0000000000ED0000, 0x0000000000EB0000, 0x0000000000E70000,
+	0x1010101010EF1010, 0x0000000000CF0000, 0x0000000000AF0000, 0x00000000006F0000,
+	0x0000000000000000, 0x0000000400000800, 0x0000000000000000, 0x0001020400002040,
+	0x1010101000001010, 0x0000804000000804, 0x0000000000000000, 0x0000004000002000,
+	0x0000020000000800, 0x0000000000000000, 0x0001020008002040, 0x0000000000000000,
+	0x1010100010001010, 0x0000000000000000, 0x0000800020000804, 0x0000000000000000,
+	0x0000000000000000, 0x0001000408002040, 0x0000000000000000, 0x0000000420000000,
+	0x1010001010001010, 0x0000004008000000, 0x0000000000000000, 0x0000004020000804,
+	0x0000020408002040, 0x0000000000000000, 0x0000020020000000, 0x0000000000000000,
+	0x1000101010001010, 0x0000000000000000, 0x0000800008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000020000000, 0x0000000000000000, 0x0000024000000000,
+	0x0010101010001010, 0x0000800400000000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000008040001000,
+	0x0000000000000000, 0x2020202020002000, 0x0000000000000000, 0x0102040810004000,
+	0x0000000800000000, 0x0000000000000000, 0x0000000010000008, 0x0000000000000000,
+	0x0000008040000008, 0x2020202020000020, 0x0102040810000080, 0x0000000000000000,
+	0x0000000000DE0000, 0x0000000000DD0000, 0x0000000000DB0000, 0x0000000000D70000,
+	0x0000000000CF0000, 0x2020202020DF2020, 0x00000000009F0000, 0x00000000005F0000,
+	0x0000040000000008, 0x0000000000000000, 0x0000000800001000, 0x0000000000000000,
+	0x0102040800004080, 0x2020202000002020, 0x0000008000001008, 0x0000000000000000,
+	0x0000000000000000, 0x0000040000001000, 0x0000000000000000, 0x0102040010004080,
+	0x0000000000000000, 0x2020200020002020, 0x0000000000000000, 0x0000000040001008,
+	0x0002000000001000, 0x0000000000000000, 0x0102000810004080, 0x0000000000000000,
+	0x0000000840000000, 0x2020002020002020, 0x0000008010000000, 0x0000000000000000,
+	0x0000000000000000, 0x0100040810004080, 0x0000000000000000, 0x0000040040000000,
+	0x0000000000000000, 0x2000202020002020, 0x0000000000000000, 0x0000000010000000,
+	0x0002040810004080, 0x0000000000000000, 0x0002000040000000, 0x0000000000000000,
+	0x0000048000000000, 0x0020202020002020, 0x0000000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000080002000, 0x0000000000000000, 0x4040404040004000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000000020000010,
+	0x0000000000000000, 0x0000000080000010, 0x4040404040000040, 0x0204081020000000,
+	0x0000000000BE0000, 0x0000000000BD0000, 0x0000000000BB0000, 0x0000000000B70000,
+	0x0000000000AF0000, 0x00000000009F0000, 0x4040404040BF4040, 0x00000000003F0000,
+	0x0000000000000000, 0x0000080000000010, 0x0000000000000000, 0x0000001000002000,
+	0x0000000000000000, 0x0204081000008000, 0x4040404000004040, 0x0000000000002010,
+	0x0004000000000010, 0x0000000000000000, 0x0000080000002000, 0x0000000000000000,
+	0x0204080020008000, 0x0000000000000000, 0x4040400040004040, 0x0000000000000000,
+	0x0000000000000000, 0x0004000000002000, 0x0000000000000000, 0x0204001020008000,
+	0x0000000000000000, 0x0000001080000000, 0x4040004040004040, 0x0000000020000000,
+	0x0200000000002000, 0x0000000000000000, 0x0200081020008000, 0x0000000000000000,
+	0x0000080080000000, 0x0000000000000000, 0x4000404040004040, 0x0000000000000000,
+	0x0000000000000000, 0x0004081020008000, 0x0000000000000000, 0x0004000080000000,
+	0x0000000000000000, 0x0000080000000000, 0x0040404040004040, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0000000000000000, 0x0000000040000000,
+	0x0000000000000000, 0x0000000000004000, 0x0000000000000000, 0x8080808080008000,
+	0x0000100000000000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000000040000020, 0x0000000000000000, 0x0000000000000020, 0x8080808080000080,
+	0x00000000007E0000, 0x00000000007D0000, 0x00000000007B0000, 0x0000000000770000,
+	0x00000000006F0000, 0x00000000005F0000, 0x00000000003F0000, 0x80808080807F8080,
+	0x0008000000000000, 0x0000000000000000, 0x0000100000000020, 0x0000000000000000,
+	0x0000002000004000, 0x0000000000000000, 0x0408102000000000, 0x8080808000008080,
+	0x0000000000000000, 0x0008000000000020, 0x0000000000000000, 0x0000100000004000,
+	0x0000000000000000, 0x0408100040000000, 0x0000000000000000, 0x8080800080008080,
+	0x0400000000000020, 0x0000000000000000, 0x0008000000004000, 0x0000000000000000,
+	0x0408002040000000, 0x0000000000000000, 0x0000002000000000, 0x8080008080008080,
+	0x0000000000000000, 0x0400000000004000, 0x0000000000000000, 0x0400102040000000,
+	0x0000000000000000, 0x0000100000000000, 0x0000000000000000, 0x8000808080008080,
+	0x0000000000004000, 0x0000000000000000, 0x0008102040000000, 0x0000000000000000,
+	0x0008000000000000, 0x0000000000000000, 0x0000100000000000, 0x0080808080008080,
+	0x0101010100010100, 0x0000000000000400, 0x0000000000000000, 0x0000000000020400,
+	0x0000000000000000, 0x0000000200000000, 0x0000000000000000, 0x0000040000000000,
+	0x0101010100010001, 0x0000000000000000, 0x0000000000020008, 0x0000000000000000,
+	0x0000000200000008, 0x0000000000000000, 0x0000040000000000, 0x0000000000000000,
+	0x0101010100000101, 0x0000000000000408, 0x0000000000000000, 0x0000000200000400,
+	0x0000000000000000, 0x0000040000000008, 0x0000000000000000, 0x0008000000000000,
+	0x01010101FE010101, 0x00000000FC000000, 0x00000000FA000000, 0x00000000F6000000,
+	0x00000000EE000000, 0x00000000DE000000, 0x00000000BE000000, 0x000000007E000000,
+	0x0101010000010101, 0x1008040000000000, 0x0000000000000000, 0x0000040000020000,
+	0x0000000000000000, 0x0008000000000400, 0x0000000000000000, 0x1000000000000008,
+	0x0101000100010101, 0x0000000000000000, 0x1008000200000000, 0x0000000000000000,
+	0x0008000000020000, 0x0000000000000000, 0x1000000000000400, 0x0000000000000000,
+	0x0100010100010101, 0x0000040000000000, 0x0000000000000000, 0x1000040200000000,
+	0x0000000000000000, 0x1000000000020000, 0x0000000000000000, 0x0000000000000400,
+	0x0001010100010101, 0x0000000000000000, 0x0008000000000000, 0x0000000000000000,
+	0x0008040200000000, 0x0000000000000000, 0x0000000000020000, 0x0000000000000000,
+	0x0000000000040000, 0x0202020200020200, 0x0000000000010800, 0x0000000000000000,
+	0x0000000100040800, 0x0000000000000000, 0x0000000400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0202020200020002, 0x0000000000000000, 0x0000000100040010,
+	0x0000000000000000, 0x0000000400000010, 0x0000000000000000, 0x0000080000000000,
+	0x2010080400000000, 0x0202020200000202, 0x0000000100000810, 0x0000000000000000,
+	0x0000000400000800, 0x0000000000000000, 0x0000080000000010, 0x0000000000000000,
+	0x00000000FC000000, 0x02020202FD020202, 0x00000000F9000000, 0x00000000F5000000,
+	0x00000000ED000000, 0x00000000DD000000, 0x00000000BD000000, 0x000000007D000000,
+	0x0000000000040810, 0x0202020000020202, 0x2010080000010000, 0x0000000000000000,
+	0x0000080000040000, 0x0000000000000000, 0x0010000000000800, 0x0000000000000000,
+	0x0000000000000000, 0x0202000200020202, 0x0000000000000000, 0x2010000400010000,
+	0x0000000000000000, 0x0010000000040000, 0x0000000000000000, 0x2000000000000800,
+	0x0000000400000000, 0x0200020200020202, 0x0000080100000000, 0x0000000000000000,
+	0x2000080400010000, 0x0000000000000000, 0x2000000000040000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020200020202, 0x0000000000000000, 0x0010000100000000,
+	0x0000000000000000, 0x0010080400010000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000000080100, 0x0404040400040400, 0x0000000000021000,
+	0x0000000000000000, 0x0000010200081000, 0x0000000000000000, 0x0000000800000000,
+	0x4020100800020000, 0x0000000000000000, 0x0404040400040004, 0x0000000000000000,
+	0x0000010200080020, 0x0000000000000000, 0x0000000800000020, 0x0000000000000000,
+	0x0000000000000000, 0x4020100800000100, 0x0404040400000404, 0x0000010200001020,
+	0x0000000000000000, 0x0000000800001000, 0x0000000000000000, 0x0000100000000020,
+	0x00000000FA000000, 0x00000000F9000000, 0x04040404FB040404, 0x00000000F3000000,
+	0x00000000EB000000, 0x00000000DB000000, 0x00000000BB000000, 0x000000007B000000,
+	0x0000000000000000, 0x0000010000081020, 0x0404040000040404, 0x4020100000020100,
+	0x0000000000000000, 0x0000100000080000, 0x0000000000000000, 0x0020000000001000,
+	0x0000000200081020, 0x0000000000000000, 0x0404000400040404, 0x0000000000000000,
+	0x4020000800020100, 0x0000000000000000, 0x0020000000080000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010800000000, 0x0400040400040404, 0x0000100200000000,
+	0x0000000000000000, 0x4000100800020100, 0x0000000000000000, 0x4000000000080000,
+	0x0000000800000000, 0x0000000000000000, 0x0004040400040404, 0x0000000000000000,
+	0x0020000200000000, 0x0000000000000000, 0x0020100800020100, 0x0000000000000000,
+	0x8040201000040200, 0x0000000000000000, 0x0000000000100200, 0x0808080800080800,
+	0x0000000000042000, 0x0000000000000000, 0x0001020400102000, 0x0000000000000000,
+	0x0000000000000000, 0x8040201000040001, 0x0000000000000000, 0x0808080800080008,
+	0x0000000000000000, 0x0001020400100040, 0x0000000000000000, 0x0000001000000040,
+	0x0000000400000200, 0x0000000000000000, 0x8040201000000201, 0x0808080800000808,
+	0x0001020400002040, 0x0000000000000000, 0x0000001000002000, 0x0000000000000000,
+	0x00000000F6000000, 0x00000000F5000000, 0x00000000F3000000, 0x08080808F7080808,
+	0x00000000E7000000, 0x00000000D7000000, 0x00000000B7000000, 0x0000000077000000,
+	0x0000020000040000, 0x0000000000000000, 0x0001020000102040, 0x0808080000080808,
+	0x8040200000040201, 0x0000000000000000, 0x0000200000100000, 0x0000000000000000,
+	0x0000000000000000, 0x0001000400102040, 0x0000000000000000, 0x0808000800080808,
+	0x0000000000000000, 0x8040001000040201, 0x0000000000000000, 0x0040000000100000,
+	0x0000020400102040, 0x0000000000000000, 0x0000021000000000, 0x0800080800080808,
+	0x0000200400000000, 0x0000000000000000, 0x8000201000040201, 0x0000000000000000,
+	0x0000000000000000, 0x0001001000000000, 0x0000000000000000, 0x0008080800080808,
+	0x0000000000000000, 0x0040000400000000, 0x0000000000000000, 0x0040201000040201,
+	0x0000000000000000, 0x0080402000080400, 0x0000000000000000, 0x0000000000200400,
+	0x1010101000101000, 0x0000000000084000, 0x0000000000000000, 0x0102040800204000,
+	0x0000000800000002, 0x0000000000000000, 0x0080402000080002, 0x0000000000000000,
+	0x1010101000100010, 0x0000000000000000, 0x0102040800200080, 0x0000000000000000,
+	0x0000000000000000, 0x0000000800000400, 0x0000000000000000, 0x0080402000000402,
+	0x1010101000001010, 0x0102040800004080, 0x0000000000000000, 0x0000002000004000,
+	0x00000000EE000000, 0x00000000ED000000, 0x00000000EB000000, 0x00000000E7000000,
+	0x10101010EF101010, 0x00000000CF000000, 0x00000000AF000000, 0x000000006F000000,
+	0x0000000000000000, 0x0000040000080000, 0x0000000000000000, 0x0102040000204080,
+	0x1010100000101010, 0x0080400000080402, 0x0000000000000000, 0x0000400000200000,
+	0x0002000000080000, 0x0000000000000000, 0x0102000800204080, 0x0000000000000000,
+	0x1010001000101010, 0x0000000000000000, 0x0080002000080402, 0x0000000000000000,
+	0x0000000000000000, 0x0100040800204080, 0x0000000000000000, 0x0000042000000000,
+	0x1000101000101010, 0x0000400800000000, 0x0000000000000000, 0x0000402000080402,
+	0x0002040800204080, 0x0000000000000000, 0x0002002000000000, 0x0000000000000000,
+	0x0010101000101010, 0x0000000000000000, 0x0080000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000804000100800, 0x0000000000000000,
+	0x0000000000400800, 0x2020202000202000, 0x0000000000108000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000000004, 0x0000000000000000, 0x0000804000100004,
+	0x0000000000000000, 0x2020202000200020, 0x0000000000000000, 0x0204081000400000,
+	0x0000080000000004, 0x0000000000000000, 0x0000001000000800, 0x0000000000000000,
+	0x0000804000000804, 0x2020202000002020, 0x0204081000008000, 0x0000000000000000,
+	0x00000000DE000000, 0x00000000DD000000, 0x00000000DB000000, 0x00000000D7000000,
+	0x00000000CF000000, 0x20202020DF202020, 0x000000009F000000, 0x000000005F000000,
+	0x0004000000000800, 0x0000000000000000, 0x0000080000100000, 0x0000000000000000,
+	0x0204080000408000, 0x2020200000202020, 0x0000800000100804, 0x0000000000000000,
+	0x0000000000000000, 0x0004000000100000, 0x0000000000000000, 0x0204001000408000,
+	0x0000000000000000, 0x2020002000202020, 0x0000000000000000, 0x0000004000100804,
+	0x0200000000100000, 0x0000000000000000, 0x0200081000408000, 0x0000000000000000,
+	0x0000084000000000, 0x2000202000202020, 0x0000801000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004081000408000, 0x0000000000000000, 0x0004004000000000,
+	0x0000000000000000, 0x0020202000202020, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0000000000000000, 0x0000008000201000,
+	0x0000000000000000, 0x0000000000801000, 0x4040404000404000, 0x0000000000200000,
+	0x0000100000000000, 0x0000000000000000, 0x0000002000000008, 0x0000000000000000,
+	0x0000008000200008, 0x0000000000000000, 0x4040404000400040, 0x0000000000000000,
+	0x0000000000000000, 0x0000100000000008, 0x0000000000000000, 0x0000002000001000,
+	0x0000000000000000, 0x0000008000001008, 0x4040404000004040, 0x0408102000000000,
+	0x00000000BE000000, 0x00000000BD000000, 0x00000000BB000000, 0x00000000B7000000,
+	0x00000000AF000000, 0x000000009F000000, 0x40404040BF404040, 0x000000003F000000,
+	0x0000000000000000, 0x0008000000001000, 0x0000000000000000, 0x0000100000200000,
+	0x0000000000000000, 0x0408100000800000, 0x4040400000404040, 0x0000000000201008,
+	0x0400000000001000, 0x0000000000000000, 0x0008000000200000, 0x0000000000000000,
+	0x0408002000800000, 0x0000000000000000, 0x4040004000404040, 0x0000000000000000,
+	0x0000000000000000, 0x0400000000200000, 0x0000000000000000, 0x0400102000800000,
+	0x0000000000000000, 0x0000108000000000, 0x4000404000404040, 0x0000002000000000,
+	0x0000000000200000, 0x0000000000000000, 0x0008102000800000, 0x0000000000000000,
+	0x0008008000000000, 0x0000000000000000, 0x0040404000404040, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000004000000000, 0x0000000000000000,
+	0x0000000000402000, 0x0000000000000000, 0x0000000000002000, 0x8080808000808000,
+	0x0000000000000000, 0x0000200000000000, 0x0000000000000000, 0x0000004000000010,
+	0x0000000000000000, 0x0000000000400010, 0x0000000000000000, 0x8080808000800080,
+	0x0010000000000000, 0x0000000000000000, 0x0000200000000010, 0x0000000000000000,
+	0x0000004000002000, 0x0000000000000000, 0x0000000000002010, 0x8080808000008080,
+	0x000000007E000000, 0x000000007D000000, 0x000000007B000000, 0x0000000077000000,
+	0x000000006F000000, 0x000000005F000000, 0x000000003F000000, 0x808080807F808080,
+	0x0800000000000010, 0x0000000000000000, 0x0010000000002000, 0x0000000000000000,
+	0x0000200000400000, 0x0000000000000000, 0x0810200000000000, 0x8080800000808080,
+	0x0000000000000000, 0x0800000000002000, 0x0000000000000000, 0x0010000000400000,
+	0x0000000000000000, 0x0810004000000000, 0x0000000000000000, 0x8080008000808080,
+	0x0000000000002000, 0x0000000000000000, 0x0800000000400000, 0x0000000000000000,
+	0x0800204000000000, 0x0000000000000000, 0x0000200000000000, 0x8000808000808080,
+	0x0000000000000000, 0x0000000000400000, 0x0000000000000000, 0x0010204000000000,
+	0x0000000000000000, 0x0010000000000000, 0x0000000000000000, 0x0080808000808080,
+	0x0101010001010100, 0x0000000000000000, 0x0000000000000800, 0x0000000000000000,
+	0x0000000002040800, 0x0000000000000000, 0x0000020000000000, 0x0000000000000000,
+	0x0101010001010001, 0x0000000000040000, 0x0000000000000000, 0x0000000002040010,
+	0x0000000000000000, 0x0000020000000010, 0x0000000000000000, 0x0004000000000000,
+	0x0101010001000101, 0x0000000000000000, 0x0000000002000810, 0x0000000000000000,
+	0x0000020000000800, 0x0000000000000000, 0x0004000000000010, 0x0000000000000000,
+	0x0101010000010101, 0x0000000000040810, 0x0000000000000000, 0x0000020000040000,
+	0x0000000000000000, 0x0004000000000800, 0x0000000000000000, 0x0800000000000010,
+	0x010101FE01010101, 0x000000FC00000000, 0x000000FA00000000, 0x000000F600000000,
+	0x000000EE00000000, 0x000000DE00000000, 0x000000BE00000000, 0x0000007E00000000,
+	0x0101000001010101, 0x0804000000000000, 0x0000000000000000, 0x0004000002000000,
+	0x0000000000000000, 0x0800000000040000, 0x0000000000000000, 0x0000000000000800,
+	0x0100010001010101, 0x0000000000000000, 0x0800020000000000, 0x0000000000000000,
+	0x0800000002000000, 0x0000000000000000, 0x0000000000040000, 0x0000000000000000,
+	0x0001010001010101, 0x0004000000000000, 0x0000000000000000, 0x0004020000000000,
+	0x0000000000000000, 0x0000000002000000, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0202020002020200, 0x0000000000000000, 0x0000000001001000,
+	0x0000000000000000, 0x0000010004081000, 0x0000000000000000, 0x0000040000000000,
+	0x0000000004000000, 0x0202020002020002, 0x0000000001080000, 0x0000000000000000,
+	0x0000010004080020, 0x0000000000000000, 0x0000040000000020, 0x0000000000000000,
+	0x0000000000000000, 0x0202020002000202, 0x0000000000000000, 0x0000010004001020,
+	0x0000000000000000, 0x0000040000001000, 0x0000000000000000, 0x0008000000000020,
+	0x1008040000000000, 0x0202020000020202, 0x0000010000081020, 0x0000000000000000,
+	0x0000040000080000, 0x0000000000000000, 0x0008000000001000, 0x0000000000000000,
+	0x000000FC00000000, 0x020202FD02020202, 0x000000F900000000, 0x000000F500000000,
+	0x000000ED00000000, 0x000000DD00000000, 0x000000BD00000000, 0x0000007D00000000,
+	0x0000000004081020, 0x0202000002020202, 0x1008000001000000, 0x0000000000000000,
+	0x0008000004000000, 0x0000000000000000, 0x1000000000080000, 0x0000000000000000,
+	0x0000000000000000, 0x0200020002020202, 0x0000000000000000, 0x1000040001000000,
+	0x0000000000000000, 0x1000000004000000, 0x0000000000000000, 0x0000000000080000,
+	0x0000040000000000, 0x0002020002020202, 0x0008010000000000, 0x0000000000000000,
+	0x0008040001000000, 0x0000000000000000, 0x0000000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0404040004040400, 0x0000000000000000,
+	0x0000000002002000, 0x0000000000000000, 0x0001020008102000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000008010000, 0x0404040004040004, 0x0000000002100000,
+	0x0000000000000000, 0x0001020008100040, 0x0000000000000000, 0x0000080000000040,
+	0x2010080002000000, 0x0000000000000000, 0x0404040004000404, 0x0000000000000000,
+	0x0001020008002040, 0x0000000000000000, 0x0000080000002000, 0x0000000000000000,
+	0x0000000000000000, 0x2010080000010000, 0x0404040000040404, 0x0001020000102040,
+	0x0000000000000000, 0x0000080000100000, 0x0000000000000000, 0x0010000000002000,
+	0x000000FA00000000, 0x000000F900000000, 0x040404FB04040404, 0x000000F300000000,
+	0x000000EB00000000, 0x000000DB00000000, 0x000000BB00000000, 0x0000007B00000000,
+	0x0000000000000000, 0x0001000008102040, 0x0404000004040404, 0x2010000002010000,
+	0x0000000000000000, 0x0010000008000000, 0x0000000000000000, 0x2000000000100000,
+	0x0000020008102040, 0x0000000000000000, 0x0400040004040404, 0x0000000000000000,
+	0x2000080002010000, 0x0000000000000000, 0x2000000008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0001080000000000, 0x0004040004040404, 0x0010020000000000,
+	0x0000000000000000, 0x0010080002010000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000100, 0x0000000000000000, 0x0808080008080800,
+	0x0000000000000000, 0x0000000004004000, 0x0000000000000000, 0x0102040010204000,
+	0x4020100004020000, 0x0000000000000000, 0x0000000010020000, 0x0808080008080008,
+	0x0000000004200000, 0x0000000000000000, 0x0102040010200080, 0x0000000000000000,
+	0x0000000000000000, 0x4020100004000100, 0x0000000000000000, 0x0808080008000808,
+	0x0000000000000000, 0x0102040010004080, 0x0000000000000000, 0x0000100000004000,
+	0x0000040000020000, 0x0000000000000000, 0x4020100000020100, 0x0808080000080808,
+	0x0102040000204080, 0x0000000000000000, 0x0000100000200000, 0x0000000000000000,
+	0x000000F600000000, 0x000000F500000000, 0x000000F300000000, 0x080808F708080808,
+	0x000000E700000000, 0x000000D700000000, 0x000000B700000000, 0x0000007700000000,
+	0x0002000004000000, 0x0000000000000000, 0x0102000010204080, 0x0808000008080808,
+	0x4020000004020100, 0x0000000000000000, 0x0020000010000000, 0x0000000000000000,
+	0x0000000000000000, 0x0100040010204080, 0x0000000000000000, 0x0800080008080808,
+	0x0000000000000000, 0x4000100004020100, 0x0000000000000000, 0x4000000010000000,
+	0x0002040010204080, 0x0000000000000000, 0x0002100000000000, 0x0008080008080808,
+	0x0020040000000000, 0x0000000000000000, 0x0020100004020100, 0x0000000000000000,
+	0x8040200008040200, 0x0000000000000000, 0x0000000020000200, 0x0000000000000000,
+	0x1010100010101000, 0x0000000000000000, 0x0000000008008000, 0x0000000000000000,
+	0x0000000000000000, 0x8040200008040001, 0x0000000000000000, 0x0000000020040000,
+	0x1010100010100010, 0x0000000008400000, 0x0000000000000000, 0x0204080020400000,
+	0x0000080000000200, 0x0000000000000000, 0x8040200008000201, 0x0000000000000000,
+	0x1010100010001010, 0x0000000000000000, 0x0204080020008000, 0x0000000000000000,
+	0x0000000000000000, 0x0000080000040000, 0x0000000000000000, 0x8040200000040201,
+	0x1010100000101010, 0x0204080000408000, 0x0000000000000000, 0x0000200000400000,
+	0x000000EE00000000, 0x000000ED00000000, 0x000000EB00000000, 0x000000E700000000,
+	0x101010EF10101010, 0x000000CF00000000, 0x000000AF00000000, 0x0000006F00000000,
+	0x0000000000000000, 0x0004000008000000, 0x0000000000000000, 0x0204000020408000,
+	0x1010000010101010, 0x8040000008040201, 0x0000000000000000, 0x0040000020000000,
+	0x0200000008000000, 0x0000000000000000, 0x0200080020408000, 0x0000000000000000,
+	0x1000100010101010, 0x0000000000000000, 0x8000200008040201, 0x0000000000000000,
+	0x0000000000000000, 0x0004080020408000, 0x0000000000000000, 0x0004200000000000,
+	0x0010100010101010, 0x0040080000000000, 0x0000000000000000, 0x0040200008040201,
+	0x0000000000000000, 0x0080400010080400, 0x0000000000000000, 0x0000000040000400,
+	0x0000000000000000, 0x2020200020202000, 0x0000000000000000, 0x0000000010000000,
+	0x0000100000000002, 0x0000000000000000, 0x0080400010080002, 0x0000000000000000,
+	0x0000000040080000, 0x2020200020200020, 0x0000000010800000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100000000400, 0x0000000000000000, 0x0080400010000402,
+	0x0000000000000000, 0x2020200020002020, 0x0000000000000000, 0x0408100040000000,
+	0x0008000000000400, 0x0000000000000000, 0x0000100000080000, 0x0000000000000000,
+	0x0080400000080402, 0x2020200000202020, 0x0408100000800000, 0x0000000000000000,
+	0x000000DE00000000, 0x000000DD00000000, 0x000000DB00000000, 0x000000D700000000,
+	0x000000CF00000000, 0x202020DF20202020, 0x0000009F00000000, 0x0000005F00000000,
+	0x0400000000080000, 0x0000000000000000, 0x0008000010000000, 0x0000000000000000,
+	0x0408000040800000, 0x2020000020202020, 0x0080000010080402, 0x0000000000000000,
+	0x0000000000000000, 0x0400000010000000, 0x0000000000000000, 0x0400100040800000,
+	0x0000000000000000, 0x2000200020202020, 0x0000000000000000, 0x0000400010080402,
+	0x0000000010000000, 0x0000000000000000, 0x0008100040800000, 0x0000000000000000,
+	0x0008400000000000, 0x0020200020202020, 0x0080100000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000800020100800, 0x0000000000000000,
+	0x0000000080000800, 0x0000000000000000, 0x4040400040404000, 0x0000000000000000,
+	0x0000000000000000, 0x0000200000000004, 0x0000000000000000, 0x0000800020100004,
+	0x0000000000000000, 0x0000000080100000, 0x4040400040400040, 0x0000000020000000,
+	0x0010000000000004, 0x0000000000000000, 0x0000200000000800, 0x0000000000000000,
+	0x0000800020000804, 0x0000000000000000, 0x4040400040004040, 0x0000000000000000,
+	0x0000000000000000, 0x0010000000000800, 0x0000000000000000, 0x0000200000100000,
+	0x0000000000000000, 0x0000800000100804, 0x4040400000404040, 0x0810200000000000,
+	0x000000BE00000000, 0x000000BD00000000, 0x000000BB00000000, 0x000000B700000000,
+	0x000000AF00000000, 0x0000009F00000000, 0x404040BF40404040, 0x0000003F00000000,
+	0x0000000000000000, 0x0800000000100000, 0x0000000000000000, 0x0010000020000000,
+	0x0000000000000000, 0x0810000080000000, 0x4040000040404040, 0x0000000020100804,
+	0x0000000000100000, 0x0000000000000000, 0x0800000020000000, 0x0000000000000000,
+	0x0800200080000000, 0x0000000000000000, 0x4000400040404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000020000000, 0x0000000000000000, 0x0010200080000000,
+	0x0000000000000000, 0x0010800000000000, 0x0040400040404040, 0x0000200000000000,
+	0x0000000000000000, 0x0000400000000000, 0x0000000000000000, 0x0000000040201000,
+	0x0000000000000000, 0x0000000000001000, 0x0000000000000000, 0x8080800080808000,
+	0x0020000000000000, 0x0000000000000000, 0x0000400000000008, 0x0000000000000000,
+	0x0000000040200008, 0x0000000000000000, 0x0000000000200000, 0x8080800080800080,
+	0x0000000000000000, 0x0020000000000008, 0x0000000000000000, 0x0000400000001000,
+	0x0000000000000000, 0x0000000040001008, 0x0000000000000000, 0x8080800080008080,
+	0x1000000000000008, 0x0000000000000000, 0x0020000000001000, 0x0000000000000000,
+	0x0000400000200000, 0x0000000000000000, 0x0000000000201008, 0x8080800000808080,
+	0x0000007E00000000, 0x0000007D00000000, 0x0000007B00000000, 0x0000007700000000,
+	0x0000006F00000000, 0x0000005F00000000, 0x0000003F00000000, 0x8080807F80808080,
+	0x0000000000001000, 0x0000000000000000, 0x1000000000200000, 0x0000000000000000,
+	0x0020000040000000, 0x0000000000000000, 0x1020000000000000, 0x8080000080808080,
+	0x0000000000000000, 0x0000000000200000, 0x0000000000000000, 0x1000000040000000,
+	0x0000000000000000, 0x1000400000000000, 0x0000000000000000, 0x8000800080808080,
+	0x0000000000200000, 0x0000000000000000, 0x0000000040000000, 0x0000000000000000,
+	0x0020400000000000, 0x0000000000000000, 0x0020000000000000, 0x0080800080808080,
+	0x0101000101010100, 0x0000000000080000, 0x0000000000000000, 0x0000000000001000,
+	0x0000000000000000, 0x0000000204081000, 0x0000000000000000, 0x0002000000000000,
+	0x0101000101010001, 0x0000000000000000, 0x0000000000080000, 0x0000000000000000,
+	0x0000000204080020, 0x0000000000000000, 0x0002000000000020, 0x0000000000000000,
+	0x0101000101000101, 0x0000000004000000, 0x0000000000000000, 0x0000000204001020,
+	0x0000000000000000, 0x0002000000001000, 0x0000000000000000, 0x0400000000000020,
+	0x0101000100010101, 0x0000000000000000, 0x0000000200081020, 0x0000000000000000,
+	0x0002000000080000, 0x0000000000000000, 0x0400000000001000, 0x0000000000000000,
+	0x0101000001010101, 0x0000000004081020, 0x0000000000000000, 0x0002000004000000,
+	0x0000000000000000, 0x0400000000080000, 0x0000000000000000, 0x0000000000001000,
+	0x0101FE0101010101, 0x0000FC0000000000, 0x0000FA0000000000, 0x0000F60000000000,
+	0x0000EE0000000000, 0x0000DE0000000000, 0x0000BE0000000000, 0x00007E0000000000,
+	0x0100000101010101, 0x0400000000000000, 0x0000000000000000, 0x0400000200000000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0000000000080000,
+	0x0001000101010101, 0x0000000000000000, 0x0002000000000000, 0x0000000000000000,
+	0x0000000200000000, 0x0000000000000000, 0x0000000004000000, 0x0000000000000000,
+	0x0000000008000000, 0x0202000202020200, 0x0000000000100000, 0x0000000000000000,
+	0x0000000100002000, 0x0000000000000000, 0x0001000408102000, 0x0000000000000000,
+	0x0000000000000000, 0x0202000202020002, 0x0000000000000000, 0x0000000100100000,
+	0x0000000000000000, 0x0001000408100040, 0x0000000000000000, 0x0004000000000040,
+	0x0000000400000000, 0x0202000202000202, 0x0000000108000000, 0x0000000000000000,
+	0x0001000408002040, 0x0000000000000000, 0x0004000000002000, 0x0000000000000000,
+	0x0000000000000000, 0x0202000200020202, 0x0000000000000000, 0x0001000400102040,
+	0x0000000000000000, 0x0004000000100000, 0x0000000000000000, 0x0800000000002000,
+	0x0804000000000000, 0x0202000002020202, 0x0001000008102040, 0x0000000000000000,
+	0x0004000008000000, 0x0000000000000000, 0x0800000000100000, 0x0000000000000000,
+	0x0000FC0000000000, 0x0202FD0202020202, 0x0000F90000000000, 0x0000F50000000000,
+	0x0000ED0000000000, 0x0000DD0000000000, 0x0000BD0000000000, 0x00007D0000000000,
+	0x0000000408102040, 0x0200000202020202, 0x0800000100000000, 0x0000000000000000,
+	0x0800000400000000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002000202020202, 0x0000000000000000, 0x0004000100000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0000000010000000, 0x0404000404040400, 0x0000000001200000,
+	0x0000000000000000, 0x0000000200004000, 0x0000000000000000, 0x0102000810204000,
+	0x0000000800000000, 0x0000000000000000, 0x0404000404040004, 0x0000000000000000,
+	0x0000000200200000, 0x0000000000000000, 0x0102000810200080, 0x0000000000000000,
+	0x0000000000000000, 0x0000000801000000, 0x0404000404000404, 0x0000000210000000,
+	0x0000000000000000, 0x0102000810004080, 0x0000000000000000, 0x0008000000004000,
+	0x1008000200000000, 0x0000000000000000, 0x0404000400040404, 0x0000000000000000,
+	0x0102000800204080, 0x0000000000000000, 0x0008000000200000, 0x0000000000000000,
+	0x0000000000000000, 0x1008000001000000, 0x0404000004040404, 0x0102000010204080,
+	0x0000000000000000, 0x0008000010000000, 0x0000000000000000, 0x1000000000200000,
+	0x0000FA0000000000, 0x0000F90000000000, 0x0404FB0404040404, 0x0000F30000000000,
+	0x0000EB0000000000, 0x0000DB0000000000, 0x0000BB0000000000, 0x00007B0000000000,
+	0x0000000000000000, 0x0100000810204080, 0x0400000404040404, 0x1000000201000000,
+	0x0000000000000000, 0x1000000800000000, 0x0000000000000000, 0x0000000010000000,
+	0x0002000810204080, 0x0000000000000000, 0x0004000404040404, 0x0000000000000000,
+	0x0008000201000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0000000020010000, 0x0808000808080800,
+	0x0000000002400000, 0x0000000000000000, 0x0000000400008000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000010000, 0x0000000000000000, 0x0808000808080008,
+	0x0000000000000000, 0x0000000400400000, 0x0000000000000000, 0x0204001020400000,
+	0x2010000402000000, 0x0000000000000000, 0x0000001002000000, 0x0808000808000808,
+	0x0000000420000000, 0x0000000000000000, 0x0204001020008000, 0x0000000000000000,
+	0x0000000000000000, 0x2010000400010000, 0x0000000000000000, 0x0808000800080808,
+	0x0000000000000000, 0x0204001000408000, 0x0000000000000000, 0x0010000000400000,
+	0x0004000002000000, 0x0000000000000000, 0x2010000002010000, 0x0808000008080808,
+	0x0204000020408000, 0x0000000000000000, 0x0010000020000000, 0x0000000000000000,
+	0x0000F60000000000, 0x0000F50000000000, 0x0000F30000000000, 0x0808F70808080808,
+	0x0000E70000000000, 0x0000D70000000000, 0x0000B70000000000, 0x0000770000000000,
+	0x0200000400000000, 0x0000000000000000, 0x0200001020408000, 0x0800000808080808,
+	0x2000000402010000, 0x0000000000000000, 0x2000001000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004001020408000, 0x0000000000000000, 0x0008000808080808,
+	0x0000000000000000, 0x0010000402010000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000100, 0x0000000000000000, 0x0000000040020000,
+	0x1010001010101000, 0x0000000004800000, 0x0000000000000000, 0x0000000800000000,
+	0x4020000804020000, 0x0000000000000000, 0x0000002000020000, 0x0000000000000000,
+	0x1010001010100010, 0x0000000000000000, 0x0000000800800000, 0x0000000000000000,
+	0x0000000000000000, 0x4020000804000100, 0x0000000000000000, 0x0000002004000000,
+	0x1010001010001010, 0x0000000840000000, 0x0000000000000000, 0x0408002040000000,
+	0x0008000000020000, 0x0000000000000000, 0x4020000800020100, 0x0000000000000000,
+	0x1010001000101010, 0x0000000000000000, 0x0408002000800000, 0x0000000000000000,
+	0x0000000000000000, 0x0008000004000000, 0x0000000000000000, 0x4020000004020100,
+	0x1010000010101010, 0x0408000040800000, 0x0000000000000000, 0x0020000040000000,
+	0x0000EE0000000000, 0x0000ED0000000000, 0x0000EB0000000000, 0x0000E70000000000,
+	0x1010EF1010101010, 0x0000CF0000000000, 0x0000AF0000000000, 0x00006F0000000000,
+	0x0000000000000000, 0x0400000800000000, 0x0000000000000000, 0x0400002040800000,
+	0x1000001010101010, 0x4000000804020100, 0x0000000000000000, 0x4000002000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0008002040800000, 0x0000000000000000,
+	0x0010001010101010, 0x0000000000000000, 0x0020000804020100, 0x0000000000000000,
+	0x8040001008040200, 0x0000000000000000, 0x0000004000000200, 0x0000000000000000,
+	0x0000000080040000, 0x2020002020202000, 0x0000000008000000, 0x0000000000000000,
+	0x0000000000000000, 0x8040001008040001, 0x0000000000000000, 0x0000004000040000,
+	0x0000000000000000, 0x2020002020200020, 0x0000000000000000, 0x0000001000000000,
+	0x0010000000000200, 0x0000000000000000, 0x8040001008000201, 0x0000000000000000,
+	0x0000004008000000, 0x2020002020002020, 0x0000001080000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010000000040000, 0x0000000000000000, 0x8040001000040201,
+	0x0000000000000000, 0x2020002000202020, 0x0000000000000000, 0x0810004000000000,
+	0x0800000000040000, 0x0000000000000000, 0x0010000008000000, 0x0000000000000000,
+	0x8040000008040201, 0x2020000020202020, 0x0810000080000000, 0x0000000000000000,
+	0x0000DE0000000000, 0x0000DD0000000000, 0x0000DB0000000000, 0x0000D70000000000,
+	0x0000CF0000000000, 0x2020DF2020202020, 0x00009F0000000000, 0x00005F0000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0800001000000000, 0x0000000000000000,
+	0x0800004080000000, 0x2000002020202020, 0x8000001008040201, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0010004080000000,
+	0x0000000000000000, 0x0020002020202020, 0x0000000000000000, 0x0040001008040201,
+	0x0000000000000000, 0x0080002010080400, 0x0000000000000000, 0x0000008000000400,
+	0x0000000000000000, 0x0000000000080000, 0x4040004040404000, 0x0000000010000000,
+	0x0020000000000002, 0x0000000000000000, 0x0080002010080002, 0x0000000000000000,
+	0x0000008000080000, 0x0000000000000000, 0x4040004040400040, 0x0000000000000000,
+	0x0000000000000000, 0x0020000000000400, 0x0000000000000000, 0x0080002010000402,
+	0x0000000000000000, 0x0000008010000000, 0x4040004040004040, 0x0000002000000000,
+	0x1000000000000400, 0x0000000000000000, 0x0020000000080000, 0x0000000000000000,
+	0x0080002000080402, 0x0000000000000000, 0x4040004000404040, 0x0000000000000000,
+	0x0000000000000000, 0x1000000000080000, 0x0000000000000000, 0x0020000010000000,
+	0x0000000000000000, 0x0080000010080402, 0x4040000040404040, 0x1020000000000000,
+	0x0000BE0000000000, 0x0000BD0000000000, 0x0000BB0000000000, 0x0000B70000000000,
+	0x0000AF0000000000, 0x00009F0000000000, 0x4040BF4040404040, 0x00003F0000000000,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x1000002000000000,
+	0x0000000000000000, 0x1000008000000000, 0x4000004040404040, 0x0000002010080402,
+	0x0000000010000000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0020008000000000, 0x0000000000000000, 0x0040004040404040, 0x0000000000000000,
+	0x0040000000000000, 0x0000000000000000, 0x0000004020100800, 0x0000000000000000,
+	0x0000000000000800, 0x0000000000000000, 0x0000000000100000, 0x8080008080808000,
+	0x0000000000000000, 0x0040000000000004, 0x0000000000000000, 0x0000004020100004,
+	0x0000000000000000, 0x0000000000100000, 0x0000000000000000, 0x8080008080800080,
+	0x2000000000000004, 0x0000000000000000, 0x0040000000000800, 0x0000000000000000,
+	0x0000004020000804, 0x0000000000000000, 0x0000000020000000, 0x8080008080008080,
+	0x0000000000000000, 0x2000000000000800, 0x0000000000000000, 0x0040000000100000,
+	0x0000000000000000, 0x0000004000100804, 0x0000000000000000, 0x8080008000808080,
+	0x0000000000000800, 0x0000000000000000, 0x2000000000100000, 0x0000000000000000,
+	0x0040000020000000, 0x0000000000000000, 0x0000000020100804, 0x8080000080808080,
+	0x00007E0000000000, 0x00007D0000000000, 0x00007B0000000000, 0x0000770000000000,
+	0x00006F0000000000, 0x00005F0000000000, 0x00003F0000000000, 0x80807F8080808080,
+	0x0000000000100000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x2000004000000000, 0x0000000000000000, 0x2000000000000000, 0x8000008080808080,
+	0x0000000000000000, 0x0000000020000000, 0x0000000000000000, 0x0000004000000000,
+	0x0000000000000000, 0x0040000000000000, 0x0000000000000000, 0x0080008080808080,
+	0x0100010101010100, 0x0000000000000000, 0x0000000000100000, 0x0000000000000000,
+	0x0000000000002000, 0x0000000000000000, 0x0000020408102000, 0x0000000000000000,
+	0x0100010101010001, 0x0000000008000000, 0x0000000000000000, 0x0000000000100000,
+	0x0000000000000000, 0x0000020408100040, 0x0000000000000000, 0x0200000000000040,
+	0x0100010101000101, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0000020408002040, 0x0000000000000000, 0x0200000000002000, 0x0000000000000000,
+	0x0100010100010101, 0x0000000400000000, 0x0000000000000000, 0x0000020400102040,
+	0x0000000000000000, 0x0200000000100000, 0x0000000000000000, 0x0000000000002000,
+	0x0100010001010101, 0x0000000000000000, 0x0000020008102040, 0x0000000000000000,
+	0x0200000008000000, 0x0000000000000000, 0x0000000000100000, 0x0000000000000000,
+	0x0100000101010101, 0x0000000408102040, 0x0000000000000000, 0x0200000400000000,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x0000000000100000,
+	0x01FE010101010101, 0x00FC000000000000, 0x00FA000000000000, 0x00F6000000000000,
+	0x00EE000000000000, 0x00DE000000000000, 0x00BE000000000000, 0x007E000000000000,
+	0x0000010101010101, 0x0000000000000000, 0x0000000000000000, 0x0000020000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0000000008000000,
+	0x0000000000000000, 0x0200020202020200, 0x0000000000000000, 0x0000000000200000,
+	0x0000000000000000, 0x0000010000004000, 0x0000000000000000, 0x0100040810204000,
+	0x0000000800000000, 0x0200020202020002, 0x0000000010000000, 0x0000000000000000,
+	0x0000010000200000, 0x0000000000000000, 0x0100040810200080, 0x0000000000000000,
+	0x0000000000000000, 0x0200020202000202, 0x0000000000000000, 0x0000010010000000,
+	0x0000000000000000, 0x0100040810004080, 0x0000000000000000, 0x0400000000004000,
+	0x0000040000000000, 0x0200020200020202, 0x0000010800000000, 0x0000000000000000,
+	0x0100040800204080, 0x0000000000000000, 0x0400000000200000, 0x0000000000000000,
+	0x0000000000000000, 0x0200020002020202, 0x0000000000000000, 0x0100040010204080,
+	0x0000000000000000, 0x0400000010000000, 0x0000000000000000, 0x0000000000200000,
+	0x0400000000000000, 0x0200000202020202, 0x0100000810204080, 0x0000000000000000,
+	0x0400000800000000, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x00FC000000000000, 0x02FD020202020202, 0x00F9000000000000, 0x00F5000000000000,
+	0x00ED000000000000, 0x00DD000000000000, 0x00BD000000000000, 0x007D000000000000,
+	0x0000040810204080, 0x0000020202020202, 0x0000010000000000, 0x0000000000000000,
+	0x0000040000000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0000001000000000, 0x0000000000000000, 0x0400040404040400, 0x0000000000000000,
+	0x0000000100400000, 0x0000000000000000, 0x0000020000008000, 0x0000000000000000,
+	0x0000000000000000, 0x0000001000000000, 0x0400040404040004, 0x0000000120000000,
+	0x0000000000000000, 0x0000020000400000, 0x0000000000000000, 0x0200081020400000,
+	0x0000080000000000, 0x0000000000000000, 0x0400040404000404, 0x0000000000000000,
+	0x0000020020000000, 0x0000000000000000, 0x0200081020008000, 0x0000000000000000,
+	0x0000000000000000, 0x0000080100000000, 0x0400040400040404, 0x0000021000000000,
+	0x0000000000000000, 0x0200081000408000, 0x0000000000000000, 0x0800000000400000,
+	0x0800020000000000, 0x0000000000000000, 0x0400040004040404, 0x0000000000000000,
+	0x0200080020408000, 0x0000000000000000, 0x0800000020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0800000100000000, 0x0400000404040404, 0x0200001020408000,
+	0x0000000000000000, 0x0800001000000000, 0x0000000000000000, 0x0000000020000000,
+	0x00FA000000000000, 0x00F9000000000000, 0x04FB040404040404, 0x00F3000000000000,
+	0x00EB000000000000, 0x00DB000000000000, 0x00BB000000000000, 0x007B000000000000,
+	0x0000000000000000, 0x0000081020408000, 0x0000040404040404, 0x0000020100000000,
+	0x0000000000000000, 0x0000080000000000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0000000000000000, 0x0800080808080800,
+	0x0000000000000000, 0x0000000200800000, 0x0000000000000000, 0x0000040000000000,
+	0x0000100000000000, 0x0000000000000000, 0x0000002001000000, 0x0800080808080008,
+	0x0000000240000000, 0x0000000000000000, 0x0000040000800000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100001000000, 0x0000000000000000, 0x0800080808000808,
+	0x0000000000000000, 0x0000040040000000, 0x0000000000000000, 0x0400102040000000,
+	0x1000040200000000, 0x0000000000000000, 0x0000100200000000, 0x0800080800080808,
+	0x0000042000000000, 0x0000000000000000, 0x0400102000800000, 0x0000000000000000,
+	0x0000000000000000, 0x1000040001000000, 0x0000000000000000, 0x0800080008080808,
+	0x0000000000000000, 0x0400100040800000, 0x0000000000000000, 0x1000000040000000,
+	0x0400000200000000, 0x0000000000000000, 0x1000000201000000, 0x0800000808080808,
+	0x0400002040800000, 0x0000000000000000, 0x1000002000000000, 0x0000000000000000,
+	0x00F6000000000000, 0x00F5000000000000, 0x00F3000000000000, 0x08F7080808080808,
+	0x00E7000000000000, 0x00D7000000000000, 0x00B7000000000000, 0x0077000000000000,
+	0x0000040000000000, 0x0000000000000000, 0x0000102040800000, 0x0000080808080808,
+	0x0000040201000000, 0x0000000000000000, 0x0000100000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000004000010000, 0x0000000000000000,
+	0x1000101010101000, 0x0000000000000000, 0x0000000400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000200000010000, 0x0000000000000000, 0x0000004002000000,
+	0x1000101010100010, 0x0000000480000000, 0x0000000000000000, 0x0000080000000000,
+	0x2000080402000000, 0x0000000000000000, 0x0000200002000000, 0x0000000000000000,
+	0x1000101010001010, 0x0000000000000000, 0x0000080080000000, 0x0000000000000000,
+	0x0000000000000000, 0x2000080400010000, 0x0000000000000000, 0x0000200400000000,
+	0x1000101000101010, 0x0000084000000000, 0x0000000000000000, 0x0800204000000000,
+	0x0800000002000000, 0x0000000000000000, 0x2000080002010000, 0x0000000000000000,
+	0x1000100010101010, 0x0000000000000000, 0x0800200080000000, 0x0000000000000000,
+	0x0000000000000000, 0x0800000400000000, 0x0000000000000000, 0x2000000402010000,
+	0x1000001010101010, 0x0800004080000000, 0x0000000000000000, 0x2000004000000000,
+	0x00EE000000000000, 0x00ED000000000000, 0x00EB000000000000, 0x00E7000000000000,
+	0x10EF101010101010, 0x00CF000000000000, 0x00AF000000000000, 0x006F000000000000,
+	0x0000000000000000, 0x0000080000000000, 0x0000000000000000, 0x0000204080000000,
+	0x0000101010101010, 0x0000080402010000, 0x0000000000000000, 0x0000200000000000,
+	0x0000000000000000, 0x0000400000000100, 0x0000000000000000, 0x0000008000020000,
+	0x0000000000000000, 0x2000202020202000, 0x0000000000000000, 0x0000000800000000,
+	0x4000100804020000, 0x0000000000000000, 0x0000400000020000, 0x0000000000000000,
+	0x0000008004000000, 0x2000202020200020, 0x0000000800000000, 0x0000000000000000,
+	0x0000000000000000, 0x4000100804000100, 0x0000000000000000, 0x0000400004000000,
+	0x0000000000000000, 0x2000202020002020, 0x0000000000000000, 0x0000100000000000,
+	0x1000000000020000, 0x0000000000000000, 0x4000100800020100, 0x0000000000000000,
+	0x0000400800000000, 0x2000202000202020, 0x0000108000000000, 0x0000000000000000,
+	0x0000000000000000, 0x1000000004000000, 0x0000000000000000, 0x4000100004020100,
+	0x0000000000000000, 0x2000200020202020, 0x0000000000000000, 0x1000400000000000,
+	0x0000000004000000, 0x0000000000000000, 0x1000000800000000, 0x0000000000000000,
+	0x4000000804020100, 0x2000002020202020, 0x1000008000000000, 0x0000000000000000,
+	0x00DE000000000000, 0x00DD000000000000, 0x00DB000000000000, 0x00D7000000000000,
+	0x00CF000000000000, 0x20DF202020202020, 0x009F000000000000, 0x005F000000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0000100000000000, 0x0000000000000000,
+	0x0000408000000000, 0x0000202020202020, 0x0000100804020100, 0x0000000000000000,
+	0x8000201008040200, 0x0000000000000000, 0x0000800000000200, 0x0000000000000000,
+	0x0000000000040000, 0x0000000000000000, 0x4000404040404000, 0x0000000000000000,
+	0x0000000000000000, 0x8000201008040001, 0x0000000000000000, 0x0000800000040000,
+	0x0000000000000000, 0x0000000008000000, 0x4000404040400040, 0x0000001000000000,
+	0x2000000000000200, 0x0000000000000000, 0x8000201008000201, 0x0000000000000000,
+	0x0000800008000000, 0x0000000000000000, 0x4000404040004040, 0x0000000000000000,
+	0x0000000000000000, 0x2000000000040000, 0x0000000000000000, 0x8000201000040201,
+	0x0000000000000000, 0x0000801000000000, 0x4000404000404040, 0x0000200000000000,
+	0x0000000000040000, 0x0000000000000000, 0x2000000008000000, 0x0000000000000000,
+	0x8000200008040201, 0x0000000000000000, 0x4000400040404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x2000001000000000,
+	0x0000000000000000, 0x8000001008040201, 0x4000004040404040, 0x2000000000000000,
+	0x00BE000000000000, 0x00BD000000000000, 0x00BB000000000000, 0x00B7000000000000,
+	0x00AF000000000000, 0x009F000000000000, 0x40BF404040404040, 0x003F000000000000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000200000000000,
+	0x0000000000000000, 0x0000800000000000, 0x0000404040404040, 0x0000201008040201,
+	0x0000000000000000, 0x0000402010080400, 0x0000000000000000, 0x0000000000000400,
+	0x0000000000000000, 0x0000000000080000, 0x0000000000000000, 0x8000808080808000,
+	0x4000000000000002, 0x0000000000000000, 0x0000402010080002, 0x0000000000000000,
+	0x0000000000080000, 0x0000000000000000, 0x0000000010000000, 0x8000808080800080,
+	0x0000000000000000, 0x4000000000000400, 0x0000000000000000, 0x0000402010000402,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x8000808080008080,
+	0x0000000000000400, 0x0000000000000000, 0x4000000000080000, 0x0000000000000000,
+	0x0000402000080402, 0x0000000000000000, 0x0000002000000000, 0x8000808000808080,
+	0x0000000000000000, 0x0000000000080000, 0x0000000000000000, 0x4000000010000000,
+	0x0000000000000000, 0x0000400010080402, 0x0000000000000000, 0x8000800080808080,
+	0x0000000000080000, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x4000002000000000, 0x0000000000000000, 0x0000002010080402, 0x8000008080808080,
+	0x007E000000000000, 0x007D000000000000, 0x007B000000000000, 0x0077000000000000,
+	0x006F000000000000, 0x005F000000000000, 0x003F000000000000, 0x807F808080808080,
+	0x0000000010000000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000400000000000, 0x0000000000000000, 0x0000000000000000, 0x0000808080808080,
+	0x0001010101010100, 0x0000000010000000, 0x0000000000000000, 0x0000000000200000,
+	0x0000000000000000, 0x0000000000004000, 0x0000000000000000, 0x0002040810204000,
+	0x0001010101010001, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x0000000000200000, 0x0000000000000000, 0x0002040810200080, 0x0000000000000000,
+	0x0001010101000101, 0x0000000800000000, 0x0000000000000000, 0x0000000010000000,
+	0x0000000000000000, 0x0002040810004080, 0x0000000000000000, 0x0000000000004000,
+	0x0001010100010101, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0002040800204080, 0x0000000000000000, 0x0000000000200000, 0x0000000000000000,
+	0x0001010001010101, 0x0000040000000000, 0x0000000000000000, 0x0002040010204080,
+	0x0000000000000000, 0x0000000010000000, 0x0000000000000000, 0x0000000000200000,
+	0x0001000101010101, 0x0000000000000000, 0x0002000810204080, 0x0000000000000000,
+	0x0000000800000000, 0x0000000000000000, 0x0000000010000000, 0x0000000000000000,
+	0x0000010101010101, 0x0000040810204080, 0x0000000000000000, 0x0000040000000000,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x0000000010000000,
+	0xFE01010101010101, 0xFC00000000000000, 0xFA00000000000000, 0xF600000000000000,
+	0xEE00000000000000, 0xDE00000000000000, 0xBE00000000000000, 0x7E00000000000000,
+	0x0000001000000000, 0x0002020202020200, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000400000, 0x0000000000000000, 0x0001000000008000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020202020002, 0x0000000000000000, 0x0000000020000000,
+	0x0000000000000000, 0x0001000000400000, 0x0000000000000000, 0x0004081020400000,
+	0x0000080000000000, 0x0002020202000202, 0x0000001000000000, 0x0000000000000000,
+	0x0001000020000000, 0x0000000000000000, 0x0004081020008000, 0x0000000000000000,
+	0x0000000000000000, 0x0002020200020202, 0x0000000000000000, 0x0001001000000000,
+	0x0000000000000000, 0x0004081000408000, 0x0000000000000000, 0x0000000000400000,
+	0x0004000000000000, 0x0002020002020202, 0x0001080000000000, 0x0000000000000000,
+	0x0004080020408000, 0x0000000000000000, 0x0000000020000000, 0x0000000000000000,
+	0x0000000000000000, 0x0002000202020202, 0x0000000000000000, 0x0004001020408000,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0000000020000000,
+	0x0000000000000000, 0x0000020202020202, 0x0000081020408000, 0x0000000000000000,
+	0x0000080000000000, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0xFC00000000000000, 0xFD02020202020202, 0xF900000000000000, 0xF500000000000000,
+	0xED00000000000000, 0xDD00000000000000, 0xBD00000000000000, 0x7D00000000000000,
+	0x0000000000000000, 0x0000002000000000, 0x0004040404040400, 0x0000000040000000,
+	0x0000000000000000, 0x0000010000800000, 0x0000000000000000, 0x0002000000000000,
+	0x0000100000000000, 0x0000000000000000, 0x0004040404040004, 0x0000000000000000,
+	0x0000010040000000, 0x0000000000000000, 0x0002000000800000, 0x0000000000000000,
+	0x0000000000000000, 0x0000100000000000, 0x0004040404000404, 0x0000012000000000,
+	0x0000000000000000, 0x0002000040000000, 0x0000000000000000, 0x0008102040000000,
+	0x0008000000000000, 0x0000000000000000, 0x0004040400040404, 0x0000000000000000,
+	0x0002002000000000, 0x0000000000000000, 0x0008102000800000, 0x0000000000000000,
+	0x0000000000000000, 0x0008010000000000, 0x0004040004040404, 0x0002100000000000,
+	0x0000000000000000, 0x0008100040800000, 0x0000000000000000, 0x0000000040000000,
+	0x0002000000000000, 0x0000000000000000, 0x0004000404040404, 0x0000000000000000,
+	0x0008002040800000, 0x0000000000000000, 0x0000002000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000010000000000, 0x0000040404040404, 0x0000102040800000,
+	0x0000000000000000, 0x0000100000000000, 0x0000000000000000, 0x0000002000000000,
+	0xFA00000000000000, 0xF900000000000000, 0xFB04040404040404, 0xF300000000000000,
+	0xEB00000000000000, 0xDB00000000000000, 0xBB00000000000000, 0x7B00000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000004000000000, 0x0008080808080800,
+	0x0000000180000000, 0x0000000000000000, 0x0000020000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000200000000000, 0x0000000000000000, 0x0008080808080008,
+	0x0000000000000000, 0x0000020080000000, 0x0000000000000000, 0x0004000000000000,
+	0x0010000000000000, 0x0000000000000000, 0x0000200100000000, 0x0008080808000808,
+	0x0000024000000000, 0x0000000000000000, 0x0004000080000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010000100000000, 0x0000000000000000, 0x0008080800080808,
+	0x0000000000000000, 0x0004004000000000, 0x0000000000000000, 0x0010204000000000,
+	0x0004020000000000, 0x0000000000000000, 0x0010020000000000, 0x0008080008080808,
+	0x0004200000000000, 0x0000000000000000, 0x0010200080000000, 0x0000000000000000,
+	0x0000000000000000, 0x0004000100000000, 0x0000000000000000, 0x0008000808080808,
+	0x0000000000000000, 0x0010004080000000, 0x0000000000000000, 0x0000004000000000,
+	0x0000020000000000, 0x0000000000000000, 0x0000020100000000, 0x0000080808080808,
+	0x0000204080000000, 0x0000000000000000, 0x0000200000000000, 0x0000000000000000,
+	0xF600000000000000, 0xF500000000000000, 0xF300000000000000, 0xF708080808080808,
+	0xE700000000000000, 0xD700000000000000, 0xB700000000000000, 0x7700000000000000,
+	0x0000000000000000, 0x0000400000000000, 0x0000000000000000, 0x0000008001000000,
+	0x0010101010101000, 0x0000000200000000, 0x0000000000000000, 0x0000040000000000,
+	0x0020000000000000, 0x0000000000000000, 0x0000400001000000, 0x0000000000000000,
+	0x0010101010100010, 0x0000000000000000, 0x0000040000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0020000001000000, 0x0000000000000000, 0x0000400200000000,
+	0x0010101010001010, 0x0000048000000000, 0x0000000000000000, 0x0008000000000000,
+	0x0008040200000000, 0x0000000000000000, 0x0020000200000000, 0x0000000000000000,
+	0x0010101000101010, 0x0000000000000000, 0x0008008000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0008040001000000, 0x0000000000000000, 0x0020040000000000,
+	0x0010100010101010, 0x0008400000000000, 0x0000000000000000, 0x0020400000000000,
+	0x0000000200000000, 0x0000000000000000, 0x0008000201000000, 0x0000000000000000,
+	0x0010001010101010, 0x0000000000000000, 0x0020008000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000040000000000, 0x0000000000000000, 0x0000040201000000,
+	0x0000101010101010, 0x0000408000000000, 0x0000000000000000, 0x0000400000000000,
+	0xEE00000000000000, 0xED00000000000000, 0xEB00000000000000, 0xE700000000000000,
+	0xEF10101010101010, 0xCF00000000000000, 0xAF00000000000000, 0x6F00000000000000,
+	0x0040000000000000, 0x0000000000000000, 0x0000800000010000, 0x0000000000000000,
+	0x0000000002000000, 0x0020202020202000, 0x0000000400000000, 0x0000000000000000,
+	0x0000000000000000, 0x0040000000010000, 0x0000000000000000, 0x0000800002000000,
+	0x0000000000000000, 0x0020202020200020, 0x0000000000000000, 0x0000080000000000,
+	0x0010080402000000, 0x0000000000000000, 0x0040000002000000, 0x0000000000000000,
+	0x0000800400000000, 0x0020202020002020, 0x0000080000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0010080400010000, 0x0000000000000000, 0x0040000400000000,
+	0x0000000000000000, 0x0020202000202020, 0x0000000000000000, 0x0010000000000000,
+	0x0000000002000000, 0x0000000000000000, 0x0010080002010000, 0x0000000000000000,
+	0x0040080000000000, 0x0020200020202020, 0x0010800000000000, 0x0000000000000000,
+	0x0000000000000000, 0x0000000400000000, 0x0000000000000000, 0x0010000402010000,
+	0x0000000000000000, 0x0020002020202020, 0x0000000000000000, 0x0040000000000000,
+	0x0000000400000000, 0x0000000000000000, 0x0000080000000000, 0x0000000000000000,
+	0x0000080402010000, 0x0000202020202020, 0x0000800000000000, 0x0000000000000000,
+	0xDE00000000000000, 0xDD00000000000000, 0xDB00000000000000, 0xD700000000000000,
+	0xCF00000000000000, 0xDF20202020202020, 0x9F00000000000000, 0x5F00000000000000,
+	0x0000000000000000, 0x0080000000000100, 0x0000000000000000, 0x0000000000020000,
+	0x0000000000000000, 0x0000000004000000, 0x0040404040404000, 0x0000000800000000,
+	0x0020100804020000, 0x0000000000000000, 0x0080000000020000, 0x0000000000000000,
+	0x0000000004000000, 0x0000000000000000, 0x0040404040400040, 0x0000000000000000,
+	0x0000000000000000, 0x0020100804000100, 0x0000000000000000, 0x0080000004000000,
+	0x0000000000000000, 0x0000000800000000, 0x0040404040004040, 0x0000100000000000,
+	0x0000000000020000, 0x0000000000000000, 0x0020100800020100, 0x0000000000000000,
+	0x0080000800000000, 0x0000000000000000, 0x0040404000404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000004000000, 0x0000000000000000, 0x0020100004020100,
+	0x0000000000000000, 0x0080100000000000, 0x0040400040404040, 0x0020000000000000,
+	0x0000000004000000, 0x0000000000000000, 0x0000000800000000, 0x0000000000000000,
+	0x0020000804020100, 0x0000000000000000, 0x0040004040404040, 0x0000000000000000,
+	0x0000000000000000, 0x0000000800000000, 0x0000000000000000, 0x0000100000000000,
+	0x0000000000000000, 0x0000100804020100, 0x0000404040404040, 0x0000000000000000,
+	0xBE00000000000000, 0xBD00000000000000, 0xBB00000000000000, 0xB700000000000000,
+	0xAF00000000000000, 0x9F00000000000000, 0xBF40404040404040, 0x3F00000000000000,
+	0x0040201008040200, 0x0000000000000000, 0x0000000000000200, 0x0000000000000000,
+	0x0000000000040000, 0x0000000000000000, 0x0000000008000000, 0x0080808080808000,
+	0x0000000000000000, 0x0040201008040001, 0x0000000000000000, 0x0000000000040000,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x0080808080800080,
+	0x0000000000000200, 0x0000000000000000, 0x0040201008000201, 0x0000000000000000,
+	0x0000000008000000, 0x0000000000000000, 0x0000001000000000, 0x0080808080008080,
+	0x0000000000000000, 0x0000000000040000, 0x0000000000000000, 0x0040201000040201,
+	0x0000000000000000, 0x0000001000000000, 0x0000000000000000, 0x0080808000808080,
+	0x0000000000040000, 0x0000000000000000, 0x0000000008000000, 0x0000000000000000,
+	0x0040200008040201, 0x0000000000000000, 0x0000200000000000, 0x0080800080808080,
+	0x0000000000000000, 0x0000000008000000, 0x0000000000000000, 0x0000001000000000,
+	0x0000000000000000, 0x0040001008040201, 0x0000000000000000, 0x0080008080808080,
+	0x0000000008000000, 0x0000000000000000, 0x0000001000000000, 0x0000000000000000,
+	0x0000200000000000, 0x0000000000000000, 0x0000201008040201, 0x0000808080808080,
+	0x7E00000000000000, 0x7D00000000000000, 0x7B00000000000000, 0x7700000000000000,
+	0x6F00000000000000, 0x5F00000000000000, 0x3F00000000000000, 0x7F80808080808080,
+};
+
+const uint8_t castle_lookup[64] = {
+	13, 15, 15, 15, 12, 15, 15, 14, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15, 7, 15, 15, 15, 3, 15, 15, 11,
+};
+
+const int16_t eval_table[13][64] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		100, 100, 100, 100, 100, 100, 100, 100,
+		105, 110, 110, 80, 80, 110, 110, 105,
+		105, 95, 90, 100, 100, 90, 95, 105,
+		100, 100, 100, 120, 120, 100, 100, 100,
+		105, 105, 110, 125, 125, 110, 105, 105,
+		110, 110, 120, 130, 130, 120, 110, 110,
+		150, 150, 150, 150, 150, 150, 150, 150,
+		100, 100, 100, 100, 100, 100, 100, 100,
+	},
+	{
+		250, 260, 270, 270, 270, 270, 260, 250,
+		260, 280, 300, 305, 305, 300, 280, 260,
+		270, 305, 310, 315, 315, 310, 305, 270,
+		270, 300, 315, 320, 320, 315, 300, 270,
+		270, 305, 315, 320, 320, 315, 305, 270,
+		270, 300, 310, 315, 315, 310, 300, 270,
+		260, 280, 300, 300, 300, 300, 280, 260,
+		250, 260, 270, 270, 270, 270, 260, 250,
+	},
+	{
+		295, 305, 305, 305, 305, 305, 305, 295,
+		305, 320, 315, 315, 315, 315, 320, 305,
+		305, 325, 325, 325, 325, 325, 325, 305,
+		305, 315, 325, 325, 325, 325, 315, 305,
+		305, 320, 320, 325, 325, 320, 320, 305,
+		305, 315, 320, 325, 325, 320, 315, 305,
+		305, 315, 315, 315, 315, 315, 315, 305,
+		295, 305, 305, 305, 305, 305, 305, 295,
+	},
+	{
+		500, 500, 500, 505, 505, 500, 500, 500,
+		495, 500, 500, 500, 500, 500, 500, 495,
+		495, 500, 500, 500, 500, 500, 500, 495,
+		495, 500, 500, 500, 500, 500, 500, 495,
+		495, 500, 500, 500, 500, 500, 500, 495,
+		495, 500, 500, 500, 500, 500, 500, 495,
+		505, 510, 510, 510, 510, 510, 510, 505,
+		500, 500, 500, 500, 500, 500, 500, 500,
+	},
+	{
+		880, 890, 890, 895, 895, 890, 890, 880,
+		890, 900, 905, 900, 900, 900, 900, 890,
+		890, 905, 905, 905, 905, 905, 900, 890,
+		900, 900, 905, 905, 905, 905, 900, 895,
+		895, 900, 905, 905, 905, 905, 900, 895,
+		890, 900, 905, 905, 905, 905, 900, 890,
+		890, 900, 900, 900, 900, 900, 900, 890,
+		880, 890, 890, 895, 895, 890, 890, 880,
+	},
+	{
+		20, 30, 10, 0, 0, 10, 30, 20,
+		20, 20, 0, 0, 0, 0, 20, 20,
+		-10, -20, -20, -20, -20, -20, -20, -10,
+		-20, -30, -30, -40, -40, -30, -30, -20,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+	},
+	{
+		-100, -100, -100, -100, -100, -100, -100, -100,
+		-150, -150, -150, -150, -150, -150, -150, -150,
+		-110, -110, -120, -130, -130, -120, -110, -110,
+		-105, -105, -110, -125, -125, -110, -105, -105,
+		-100, -100, -100, -120, -120, -100, -100, -100,
+		-105, -95, -90, -100, -100, -90, -95, -105,
+		-105, -110, -110, -80, -80, -110, -110, -105,
+		-100, -100, -100, -100, -100, -100, -100, -100,
+	},
+	{
+		-250, -260, -270, -270, -270, -270, -260, -250,
+		-260, -280, -300, -300, -300, -300, -280, -260,
+		-270, -300, -310, -315, -315, -310, -300, -270,
+		-270, -305, -315, -320, -320, -315, -305, -270,
+		-270, -300, -315, -320, -320, -315, -300, -270,
+		-270, -305, -310, -315, -315, -310, -305, -270,
+		-260, -280, -300, -305, -305, -300, -280, -260,
+		-250, -260, -270, -270, -270, -270, -260, -250,
+	},
+	{
+		-295, -305, -305, -305, -305, -305, -305, -295,
+		-305, -315, -315, -315, -315, -315, -315, -305,
+		-305, -315, -320, -325, -325, -320, -315, -305,
+		-305, -320, -320, -325, -325, -320, -320, -305,
+		-305, -315, -325, -325, -325, -325, -315, -305,
+		-305, -325, -325, -325, -325, -325, -325, -305,
+		-305, -320, -315, -315, -315, -315, -320, -305,
+		-295, -305, -305, -305, -305, -305, -305, -295,
+	},
+	{
+		-500, -500, -500, -500, -500, -500, -500, -500,
+		-505, -510, -510, -510, -510, -510, -510, -505,
+		-495, -500, -500, -500, -500, -500, -500, -495,
+		-495, -500, -500, -500, -500, -500, -500, -495,
+		-495, -500, -500, -500, -500, -500, -500, -495,
+		-495, -500, -500, -500, -500, -500, -500, -495,
+		-495, -500, -500, -500, -500, -500, -500, -495,
+		-500, -500, -500, -505, -505, -500, -500, -500,
+	},
+	{
+		-880, -890, -890, -895, -895, -890, -890, -880,
+		-890, -900, -900, -900, -900, -900, -900, -890,
+		-890, -900, -905, -905, -905, -905, -900, -890,
+		-895, -900, -905, -905, -905, -905, -900, -895,
+		-900, -900, -905, -905, -905, -905, -900, -895,
+		-890, -905, -905, -905, -905, -905, -900, -890,
+		-890, -900, -905, -900, -900, -900, -900, -890,
+		-880, -890, -890, -895, -895, -890, -890, -880,
+	},
+	{
+		30, 40, 40, 50, 50, 40, 40, 30,
+		30, 40, 40, 50, 50, 40, 40, 30,
+		30, 40, 40, 50, 50, 40, 40, 30,
+		30, 40, 40, 50, 50, 40, 40, 30,
+		20, 30, 30, 40, 40, 30, 30, 20,
+		10, 20, 20, 20, 20, 20, 20, 10,
+		-20, -20, 0, 0, 0, 0, -20, -20,
+		-20, -30, -10, 0, 0, -10, -30, -20,
+	},
+};
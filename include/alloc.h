@@ -0,0 +1,45 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ALLOC_H
+#define ALLOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum alloc_pages {
+	PAGES_NORMAL,
+	/* madvise asked for transparent huge pages */
+	PAGES_TRANSPARENT,
+	/* explicitly reserved huge pages */
+	PAGES_HUGETLB,
+};
+
+/* zeroed memory for large tables. Huge pages are tried first, since a
+ * table of several gigabytes in 4 KiB pages misses the tlb on almost
+ * every probe. Returns NULL if no memory could be allocated.
+ */
+void *alloc_large(size_t size, int *pages);
+
+void free_large(void *ptr, size_t size);
+
+const char *alloc_pages_string(int pages);
+
+/* transparent huge pages backing the process in KiB, -1 if unknown */
+int64_t alloc_anon_huge_kib();
+
+#endif
@@ -23,10 +23,9 @@
 #include "bitboard.h"
 #include "magic_bitboard.h"
 
-void attack_gen_init();
-
-extern uint64_t knight_attacks_lookup[64];
-extern uint64_t king_attacks_lookup[64];
+/* generated by tablegen */
+extern const uint64_t knight_attacks_lookup[64];
+extern const uint64_t king_attacks_lookup[64];
 
 static inline uint64_t white_pawn_capture_e(uint64_t pawns, uint64_t black_pieces) {
 	return pawns & shift_south_west(black_pieces);
@@ -52,6 +51,18 @@ static inline uint64_t black_pawn_push(uint64_t pawns, uint64_t pieces) {
 static inline uint64_t black_pawn_double_push(uint64_t pawns, uint64_t pieces) {
 	return black_pawn_push(pawns, pieces) & ~shift_north_north(pieces) & RANK_7;
 }
+static inline uint64_t pawn_capture_e(int us, uint64_t pawns, uint64_t pieces) {
+	return us ? white_pawn_capture_e(pawns, pieces) : black_pawn_capture_e(pawns, pieces);
+}
+static inline uint64_t pawn_capture_w(int us, uint64_t pawns, uint64_t pieces) {
+	return us ? white_pawn_capture_w(pawns, pieces) : black_pawn_capture_w(pawns, pieces);
+}
+static inline uint64_t pawn_push(int us, uint64_t pawns, uint64_t pieces) {
+	return us ? white_pawn_push(pawns, pieces) : black_pawn_push(pawns, pieces);
+}
+static inline uint64_t pawn_double_push(int us, uint64_t pawns, uint64_t pieces) {
+	return us ? white_pawn_double_push(pawns, pieces) : black_pawn_double_push(pawns, pieces);
+}
 
 static inline uint64_t knight_attacks(int square) {
 	return knight_attacks_lookup[square];
@@ -64,7 +75,7 @@ static inline uint64_t black_knight_attacks(int square, uint64_t black_pieces) {
 }
 
 static inline uint64_t bishop_attacks(int square, uint64_t pieces) {
-	return bishop_attacks_lookup[bishop_index(square, pieces)];
+	return magic_attacks(&bishop_magic[square], pieces);
 }
 static inline uint64_t white_bishop_attacks(int square, uint64_t white_pieces, uint64_t pieces) {
 	return bishop_attacks(square, pieces) & ~white_pieces;
@@ -74,7 +85,7 @@ static inline uint64_t black_bishop_attacks(int square, uint64_t black_pieces, u
 }
 
 static inline uint64_t rook_attacks(int square, uint64_t pieces) {
-	return rook_attacks_lookup[rook_index(square, pieces)];
+	return magic_attacks(&rook_magic[square], pieces);
 }
 static inline uint64_t white_rook_attacks(int square, uint64_t white_pieces, uint64_t pieces) {
 	return rook_attacks(square, pieces) & ~white_pieces;
@@ -20,8 +20,6 @@
 
 #include <stdint.h>
 
-void bitboard_init();
-
 #if __GNUC__
 static inline uint64_t ctz(uint64_t b) {
 	return __builtin_ctzll(b);
@@ -88,12 +86,14 @@ static inline uint64_t insert_zero(uint64_t b, int i) {
 	return ((b << 1) & ~(bitboard(i + 1) - 1)) | (b & (bitboard(i) - 1));
 }
 
-extern uint64_t between_lookup[64 * 64];
-extern uint64_t line_lookup[64 * 64];
-extern int castle_lookup[64 * 64 * 16];
+/* generated by tablegen */
+extern const uint64_t between_lookup[64 * 64];
+extern const uint64_t line_lookup[64 * 64];
+/* the castling rights kept when a piece moves from or to the square */
+extern const uint8_t castle_lookup[64];
 
 static inline int castle(int source_square, int target_square, int castle) {
-	return castle_lookup[source_square + 64 * target_square + 64 * 64 * castle];
+	return castle & castle_lookup[source_square] & castle_lookup[target_square];
 }
 
 extern const uint64_t FILE_H;
@@ -146,4 +146,21 @@ static inline uint64_t shift_south_south(uint64_t b) {
 	return b >> 16;
 }
 
+/* relative to the side us, 1 for white and 0 for black */
+static inline uint64_t shift_forward(int us, uint64_t b) {
+	return us ? shift_north(b) : shift_south(b);
+}
+static inline uint64_t shift_backward(int us, uint64_t b) {
+	return us ? shift_south(b) : shift_north(b);
+}
+static inline uint64_t shift_backward_backward(int us, uint64_t b) {
+	return us ? shift_south_south(b) : shift_north_north(b);
+}
+static inline uint64_t shift_backward_west(int us, uint64_t b) {
+	return us ? shift_south_west(b) : shift_north_west(b);
+}
+static inline uint64_t shift_backward_east(int us, uint64_t b) {
+	return us ? shift_south_east(b) : shift_north_east(b);
+}
+
 #endif
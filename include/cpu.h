@@ -0,0 +1,40 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef CPU_H
+#define CPU_H
+
+enum cpu_feature {
+	CPU_POPCNT    = 0x1,
+	CPU_BMI1      = 0x2,
+	CPU_BMI2      = 0x4,
+	CPU_AVX2      = 0x8,
+	/* pext and pdep are microcoded, amd before zen 3 */
+	CPU_SLOW_PEXT = 0x10,
+};
+
+extern int cpu_features;
+
+void cpu_init();
+
+static inline int cpu_has(int features) {
+	return (cpu_features & features) == features;
+}
+
+char *cpu_string(char *str);
+
+#endif
@@ -21,12 +21,18 @@
 #include "position.h"
 #include "move.h"
 
-int count_position(struct position *pos);
+/* material and piece square values, generated by tablegen from the
+ * tables in src/tablegen.c.
+ */
+extern const int16_t eval_table[13][64];
 
-int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose);
+/* indexed by depth, which is unique for each ply within an iteration */
+extern move killer_move[256][2];
+
+int count_position(struct position *pos);
 
-int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose);
+int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose, int timing);
 
-void evaluate_init();
+int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose, int timing);
 
 #endif
@@ -21,16 +21,65 @@
 #include <stdint.h>
 
 #include "position.h"
+#include "util.h"
 
+/* what the stored evaluation says about the real one */
+enum bound {
+	BOUND_UPPER = 0x1,
+	BOUND_LOWER = 0x2,
+	BOUND_EXACT = BOUND_UPPER | BOUND_LOWER,
+};
+
+/* an entry as it is read from and written to the table, 8 bytes */
 struct hash_entry {
-	uint64_t zobrist_key;
+	/* best move, 16 bit, 0 if no move is known to be best */
+	uint16_t move;
 	int16_t evaluation;
+	/* count_position of the position */
+	int16_t static_evaluation;
+	/* 0 if the entry is empty */
 	int8_t depth;
+	/* 0-1: enum bound
+	 * 2-7: the search which stored the entry
+	 */
+	uint8_t bound_generation;
 };
 
+#define HASH_BUCKET_ENTRIES 6
+#define HASH_GENERATIONS 64
+
+static inline int entry_bound(const struct hash_entry *entry) {
+	return entry->bound_generation & 0x3;
+}
+
+static inline int entry_generation(const struct hash_entry *entry) {
+	return entry->bound_generation >> 2;
+}
+
+/* one cache line, a probe touches a single line. 4 bytes are padding.
+ *
+ * The table is shared by all threads without a lock. Entry i is stored
+ * as the 64 bit word data[i] and the 16 bit check[i], which is the lower
+ * 16 bits of the zobrist key xored with the folded data. Both are read
+ * and written atomically but not together, so an entry which is written
+ * by two threads at once will fail the check like an entry of another
+ * position. The bucket is given by the upper bits of the key.
+ */
+struct hash_bucket {
+	uint64_t data[HASH_BUCKET_ENTRIES];
+	uint16_t check[HASH_BUCKET_ENTRIES];
+} CACHE_ALIGN;
+
+#define ZOBRIST_KEYS (12 * 64 + 1 + 16 + 8)
+
 struct hash_table {
-	struct hash_entry *table;
+	struct hash_bucket *table;
+	/* number of buckets */
 	uint64_t size;
+	/* 0 to HASH_GENERATIONS - 1 */
+	uint8_t generation;
+	/* enum alloc_pages */
+	int pages;
 
 	/* 12 * 64: each piece each square
 	 * 1: turn to move is white
@@ -40,16 +89,53 @@ struct hash_table {
 	uint64_t *zobrist_key;
 };
 
+extern struct hash_table *hash_table;
+
 uint64_t hash_table_size_bytes();
 
-struct hash_entry *table_entry(struct position *pos);
+/* a multiply instead of a division by the number of buckets, which can
+ * be any number. The index depends on the upper bits of the key.
+ */
+static inline struct hash_bucket *hash_table_bucket(uint64_t zobrist_key) {
+	return hash_table->table + mul_hi64(zobrist_key, hash_table->size);
+}
+
+/* starts loading the bucket of the key so that a later probe does not
+ * wait for memory.
+ */
+static inline void hash_table_prefetch(uint64_t zobrist_key) {
+	PREFETCH(hash_table_bucket(zobrist_key));
+}
+
+/* copies the entry of the position in its bucket to entry, returns 0
+ * if it is not there. The bucket of a position does not change when
+ * entries are replaced, so a search can probe and store with the same
+ * bucket.
+ */
+int bucket_entry(struct hash_bucket *bucket, struct position *pos, struct hash_entry *entry);
+
+void store_bucket_entry(struct hash_bucket *bucket, struct position *pos, int16_t evaluation, int16_t static_evaluation, int8_t depth, int bound, uint16_t best_move);
 
-void store_table_entry(struct position *pos, int16_t evaluation, int8_t depth);
+/* copies the entry of the position to entry, returns 0 if it is not in
+ * the table.
+ */
+int table_entry(struct position *pos, struct hash_entry *entry);
+
+void store_table_entry(struct position *pos, int16_t evaluation, int16_t static_evaluation, int8_t depth, int bound, uint16_t best_move);
 
 uint64_t hash_table_size();
 
 void hash_table_clear();
 
+/* ages the entries of earlier searches so that they are replaced first */
+void hash_table_new_search();
+
+/* prints the latency of the bucket index and of a probe */
+void hash_table_bench(uint64_t count);
+
+/* sets the size of the table, reallocates it if it already exists */
+int hash_table_resize(uint64_t bytes);
+
 uint64_t zobrist_piece_key(int piece, int square);
 
 uint64_t zobrist_turn_key();
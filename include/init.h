@@ -20,7 +20,7 @@
 
 #include <inttypes.h>
 
-int init();
+int init(int *argc, char ***argv);
 
 void term();
 
@@ -25,6 +25,8 @@ struct arg {
 	int f;
 	int h;
 	int m;
+	int j;
+	int p;
 	int argc;
 	char **argv;
 };
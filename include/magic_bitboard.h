@@ -19,27 +19,59 @@
 #define MAGIC_BITBOARD_H
 
 #include <stdint.h>
+#ifdef BMI2
+#include <immintrin.h>
+#endif
 
 int magic_bitboard_init();
 
-extern uint64_t bishop_attacks_lookup[64 * 512];
-extern uint64_t rook_attacks_lookup[64 * 4096];
+void magic_bitboard_term();
 
-extern uint64_t bishop_magic[64];
-extern uint64_t rook_magic[64];
+int magic_bitboard_find();
 
-extern uint64_t bishop_mask[64];
-extern uint64_t rook_mask[64];
+uint64_t bishop_attacks_calc(int square, uint64_t b);
+uint64_t rook_attacks_calc(int square, uint64_t b);
 
-extern uint64_t bishop_full_mask[64];
-extern uint64_t rook_full_mask[64];
+/* 32 bytes so that a lookup touches a single cache line. shift is
+ * 64 minus the number of relevant bits, attacks points into
+ * sliding_attacks_lookup.
+ */
+struct magic {
+	uint64_t mask;
+	uint64_t magic;
+	uint64_t *attacks;
+	unsigned int shift;
+};
 
-static inline int bishop_index(int square, uint64_t b) {
-	return (((b & bishop_mask[square]) * bishop_magic[square]) >> (64 - 9)) + 512 * square;
-}
+/* one entry per relevant occupancy, sum over the squares of 2^bits */
+#define BISHOP_ATTACKS_SIZE 5248
+#define ROOK_ATTACKS_SIZE 102400
+
+#define SLIDING_ATTACKS_SIZE (BISHOP_ATTACKS_SIZE + ROOK_ATTACKS_SIZE)
+
+/* allocated by magic_bitboard_init, NULL if the table file is mapped */
+extern uint64_t *sliding_attacks_lookup;
+/* enum alloc_pages */
+extern int sliding_attacks_pages;
 
-static inline int rook_index(int square, uint64_t b) {
-	return (((b & rook_mask[square]) * rook_magic[square]) >> (64 - 12)) + 4096 * square;
+extern struct magic bishop_magic[64];
+extern struct magic rook_magic[64];
+
+#ifndef BMI2
+extern const uint64_t bishop_magic_number[64];
+extern const uint64_t rook_magic_number[64];
+#endif
+
+/* only valid in the move generation kernel, the table is laid out for
+ * whichever kernel move_gen_init selected.
+ */
+static inline uint64_t magic_attacks(const struct magic *m, uint64_t b) {
+#ifdef BMI2
+	/* pext packs the occupied mask bits into a dense index, no magics needed */
+	return m->attacks[_pext_u64(b, m->mask)];
+#else
+	return m->attacks[((b & m->mask) * m->magic) >> m->shift];
+#endif
 }
 
 #endif
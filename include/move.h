@@ -26,37 +26,39 @@
  * 6-11 target square.
  * 12-13 flag, 0: none, 1: en passant, 2: promotion, 3: castle.
  * 14-15 promotion piece, 0: knight, 1: bishop, 2: rook, 3: queen.
- * 16-18 capture, 0: no piece, 1: pawn, 2: knight, 3: bishop, 4: rook, 5: queen.
- * 19-23 available castles before move. First bit, 0: K, 1: Q, 2: k, 3: q.
- * 24-29 en passant square before move.
- * 30-35 halfmove.
- * 36-63 fullmove.
  */
-typedef uint64_t move;
+typedef uint16_t move;
+
+/* the state which is lost when a move is made, kept by the caller for
+ * each ply. halfmove and zobrist_key are only used by the zobrist
+ * variants.
+ */
+struct undo {
+	uint64_t zobrist_key;
+	uint16_t halfmove;
+	uint8_t castle;
+	int8_t en_passant;
+	/* 0: no piece, 1: pawn, 2: knight, 3: bishop, 4: rook, 5: queen */
+	uint8_t captured;
+};
 
-/* uint32_t fastest? */
 static inline uint8_t move_from(move *m) { return *m & 0x3F; }
 static inline uint8_t move_to(move *m) { return (*m >> 0x6) & 0x3F; }
 static inline uint8_t move_flag(move *m) { return (*m >> 0xC) & 0x3; }
 static inline uint8_t move_promote(move *m) { return (*m >> 0xE) & 0x3; }
-static inline uint8_t move_capture(move *m) { return (*m >> 0x10) & 0x7; }
-static inline uint8_t move_castle(move *m) { return (*m >> 0x13) & 0xF; }
-static inline uint8_t move_en_passant(move *m) { return (*m >> 0x18) & 0x3F; }
-static inline uint8_t move_halfmove(move *m) { return (*m >> 0x1E) & 0x3F; }
-static inline uint32_t move_fullmove(move *m) { return (*m >> 0x24); }
-static inline void move_set_captured(move *m, uint8_t i) { *m |= (i << 0x10); }
-static inline void move_set_castle(move *m, uint8_t i) { *m |= (i << 0x13); }
-static inline void move_set_en_passant(move *m, uint8_t i) { *m |= (i << 0x18); }
-static inline void move_set_halfmove(move *m, uint8_t i) { *m |= (i << 0x1E); }
-static inline void move_set_fullmove(move *m, uint64_t i) { *m |= (i << 0x24); }
 
-void do_move(struct position *pos, move *m);
+void do_move(struct position *pos, move *m, struct undo *u);
 
-void undo_move(struct position *pos, move *m);
+void undo_move(struct position *pos, move *m, struct undo *u);
 
-void do_move_zobrist(struct position *pos, move *m);
+void do_move_zobrist(struct position *pos, move *m, struct undo *u);
 
-void undo_move_zobrist(struct position *pos, move *m);
+void undo_move_zobrist(struct position *pos, move *m, struct undo *u);
+
+/* do_move_zobrist which also prefetches the hash table bucket of the
+ * new position, undone by undo_move_zobrist.
+ */
+void do_move_prefetch(struct position *pos, move *m, struct undo *u);
 
 static inline move new_move(uint8_t source_square, uint8_t target_square, uint8_t flag, uint8_t promotion) {
 	return source_square | (target_square << 0x6) | (flag << 0xC) | (promotion << 0xE);
@@ -21,12 +21,47 @@
 #include "position.h"
 #include "move.h"
 
+/* the white and black functions point into the kernel selected by
+ * move_gen_init.
+ */
+extern move *(*generate_white)(struct position *pos, move *move_list);
+extern move *(*generate_black)(struct position *pos, move *move_list);
+extern move *(*generate_captures_white)(struct position *pos, move *move_list);
+extern move *(*generate_captures_black)(struct position *pos, move *move_list);
+/* the legal moves which are not generated by generate_captures */
+extern move *(*generate_quiets_white)(struct position *pos, move *move_list);
+extern move *(*generate_quiets_black)(struct position *pos, move *move_list);
+extern uint64_t (*count_white)(struct position *pos);
+extern uint64_t (*count_black)(struct position *pos);
+
+/* checks if a move from outside of the move generation, such as a hash
+ * or killer move, is legal without generating any moves.
+ */
+extern int (*move_is_legal)(struct position *pos, move m);
+
+extern int move_gen_kernel;
+
+void move_gen_init();
+
+const char *move_gen_kernel_name();
+
+int move_gen_pext();
+
+int move_gen_popcnt();
+
 move *generate_all(struct position *pos, move *move_list);
 
-move *generate_white(struct position *pos, move *move_list);
+move *generate_captures_all(struct position *pos, move *move_list);
 
-move *generate_black(struct position *pos, move *move_list);
+move *generate_quiets_all(struct position *pos, move *move_list);
+
+uint64_t count_all(struct position *pos);
 
 int move_count(move *m);
 
+/* compares move_is_legal with generate_all, returns the number of moves
+ * on which they disagree.
+ */
+uint64_t move_gen_check(int positions);
+
 #endif
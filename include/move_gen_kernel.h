@@ -0,0 +1,59 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOVE_GEN_KERNEL_H
+#define MOVE_GEN_KERNEL_H
+
+#include <stdint.h>
+
+#include "position.h"
+#include "move.h"
+
+/* generic: baseline x86-64 or any other architecture.
+ * popcnt: hardware popcount, magic sliders.
+ * bmi2: hardware popcount, tzcnt, pext sliders and avx2.
+ */
+enum kernel { KERNEL_GENERIC, KERNEL_POPCNT, KERNEL_BMI2, KERNELS };
+
+#define KERNEL_NAME_(name, kernel) name##_##kernel
+#define KERNEL_NAME(name, kernel) KERNEL_NAME_(name, kernel)
+#define KERNEL_FUNCTION(name) KERNEL_NAME(name, KERNEL)
+
+#define KERNEL_DECLARE(kernel)                                                      \
+move *generate_white_##kernel(struct position *pos, move *move_list);               \
+move *generate_black_##kernel(struct position *pos, move *move_list);               \
+move *generate_captures_white_##kernel(struct position *pos, move *move_list);      \
+move *generate_captures_black_##kernel(struct position *pos, move *move_list);      \
+move *generate_quiets_white_##kernel(struct position *pos, move *move_list);        \
+move *generate_quiets_black_##kernel(struct position *pos, move *move_list);        \
+uint64_t count_white_##kernel(struct position *pos);                                \
+uint64_t count_black_##kernel(struct position *pos);                                \
+uint64_t generate_checkers_white_##kernel(struct position *pos);                    \
+uint64_t generate_checkers_black_##kernel(struct position *pos);                    \
+uint64_t generate_attacked_white_##kernel(struct position *pos);                    \
+uint64_t generate_attacked_black_##kernel(struct position *pos);                    \
+uint64_t generate_pinned_white_##kernel(struct position *pos);                      \
+uint64_t generate_pinned_black_##kernel(struct position *pos);                      \
+int move_is_legal_##kernel(struct position *pos, move m);
+
+KERNEL_DECLARE(generic)
+#ifdef CPU_DISPATCH
+KERNEL_DECLARE(popcnt)
+KERNEL_DECLARE(bmi2)
+#endif
+
+#endif
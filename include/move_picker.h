@@ -0,0 +1,58 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MOVE_PICKER_H
+#define MOVE_PICKER_H
+
+#include <stdint.h>
+
+#include "position.h"
+#include "move.h"
+
+enum move_picker_stage {
+	STAGE_HASH,
+	STAGE_CAPTURES_GEN,
+	STAGE_CAPTURES,
+	STAGE_KILLERS,
+	STAGE_QUIETS_GEN,
+	STAGE_QUIETS,
+	STAGE_DONE,
+};
+
+/* hands out moves one at a time, moves are only generated when the
+ * stage before has been exhausted so that a cutoff saves the rest.
+ * hash_move and killer are 0 if there is none.
+ */
+struct move_picker {
+	struct position *pos;
+	int stage;
+	move hash_move;
+	move killer[2];
+	move move_list[256];
+	int16_t score[256];
+	int index;
+	int end;
+};
+
+void move_picker_init(struct move_picker *mp, struct position *pos, move hash_move, move *killer);
+
+move move_picker_next(struct move_picker *mp);
+
+int move_is_tactical(struct position *pos, move m);
+
+void store_killer(move *killer, move m);
+
+#endif
@@ -28,4 +28,24 @@ uint64_t perft_white(struct position *pos, int depth, int print, int verbose);
 
 uint64_t perft_black(struct position *pos, int depth, int print, int verbose);
 
+uint64_t perft_hash(struct position *pos, int depth, int print, int verbose);
+
+uint64_t perft_threads(struct position *pos, int depth, int threads, int hash, int print, int verbose);
+
+int perft_split(struct position *pos, int depth, int split_depth, char *path);
+
+int perft_run(char *units_path, char *results_path, int worker, int workers, int threads, int hash, int verbose);
+
+int perft_merge(char *units_path, int argc, char **argv);
+
+int perft_suite(char *path, int max_depth, int threads, int hash, int verbose);
+
+/* 0 if the perft table is not allocated */
+uint64_t perft_table_size_bytes();
+
+/* enum alloc_pages of the perft table */
+int perft_table_pages();
+
+void perft_term();
+
 #endif
@@ -52,12 +52,13 @@ enum piece { all, pawn, knight, bishop, rook, queen, king };
 
 enum colored_piece { empty, white_pawn, white_knight, white_bishop, white_rook, white_queen, white_king, black_pawn, black_knight, black_bishop, black_rook, black_queen, black_king };
 
-uint64_t generate_checkers_white(struct position *pos);
-uint64_t generate_checkers_black(struct position *pos);
-uint64_t generate_attacked_white(struct position *pos);
-uint64_t generate_attacked_black(struct position *pos);
-uint64_t generate_pinned_white(struct position *pos);
-uint64_t generate_pinned_black(struct position *pos);
+/* selected at startup by move_gen_init */
+extern uint64_t (*generate_checkers_white)(struct position *pos);
+extern uint64_t (*generate_checkers_black)(struct position *pos);
+extern uint64_t (*generate_attacked_white)(struct position *pos);
+extern uint64_t (*generate_attacked_black)(struct position *pos);
+extern uint64_t (*generate_pinned_white)(struct position *pos);
+extern uint64_t (*generate_pinned_black)(struct position *pos);
 
 static inline void swap_turn(struct position *pos) {
 	pos->turn = 1 - pos->turn;
@@ -71,7 +72,9 @@ char *castle_string(char *str, int castle);
 
 void pos_from_fen(struct position *pos, int argc, char **argv);
 
-void random_pos(struct position *pos, int n);
+struct rand_state;
+
+void random_pos(struct position *pos, int n, struct rand_state *state);
 
 char *pos_to_fen(char *fen, struct position *pos);
 
@@ -0,0 +1,38 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TABLE_CACHE_H
+#define TABLE_CACHE_H
+
+#include <stdint.h>
+
+/* maps the file in BITBIT_TABLES if it is valid for this build */
+void table_cache_init();
+
+/* writes the initialised tables to BITBIT_TABLES if it was not mapped */
+int table_cache_store();
+
+void table_cache_term();
+
+int table_cache_mapped();
+
+/* NULL unless the file is mapped */
+const uint64_t *table_cache_attacks();
+
+const uint64_t *table_cache_zobrist();
+
+#endif
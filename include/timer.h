@@ -0,0 +1,59 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+
+/* how timing results are printed */
+#define TIMER_HUMAN   1
+#define TIMER_MACHINE 2
+
+enum profile_timer {
+	PROFILE_MOVEGEN,
+	PROFILE_MAKEMOVE,
+	PROFILE_EVALUATE,
+	PROFILE_TIMERS,
+};
+
+/* the profile timers read the clock twice for every timed call which
+ * slows down the engine considerably, they are only compiled in when
+ * built with make PROFILE=1.
+ */
+#ifdef PROFILE
+#define PROFILE_CALL(timer, x) do {                               \
+		uint64_t profile_start = time_ns();                       \
+		x;                                                        \
+		profile_add(timer, time_ns() - profile_start);            \
+	} while (0)
+#else
+#define PROFILE_CALL(timer, x) do { x; } while (0)
+#endif
+
+uint64_t time_ns();
+
+double wall_time();
+
+void profile_add(enum profile_timer timer, uint64_t ns);
+
+void profile_reset();
+
+void timer_print(int format, char *name, int depth, uint64_t nodes, uint64_t ns);
+
+void profile_print(int format, uint64_t ns);
+
+#endif
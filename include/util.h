@@ -29,10 +29,64 @@
 
 #define UNUSED(x) (void)(x)
 
+#if __GNUC__
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#elif _MSC_VER
+#define ALWAYS_INLINE __forceinline
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+#if __GNUC__
+#define CACHE_ALIGN __attribute__((aligned(64)))
+#else
+#define CACHE_ALIGN
+#endif
+
+#if __GNUC__
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p) UNUSED(p)
+#endif
+
+/* the upper 64 bits of the 128 bit product. mul_hi64(x, n) maps x
+ * uniformly to [0, n) without a division.
+ */
+static inline uint64_t mul_hi64(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+	__extension__ typedef unsigned __int128 uint128_t;
+	return ((uint128_t)a * b) >> 64;
+#else
+	uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+	uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+	uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+	uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+	uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+	return (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
 /* exploit of how macro expansions work */
 #define MACRO_NAME(x) #x
 #define MACRO_VALUE(x) MACRO_NAME(x)
 
+/* xoshiro256** seeded with splitmix64. The sequence only depends on
+ * the seed, not on the c library. Every thread uses its own state.
+ */
+struct rand_state {
+	uint64_t s[4];
+};
+
+/* the main thread's state, seeded by util_init */
+extern struct rand_state main_rand;
+
+void rand_seed(struct rand_state *state, uint64_t seed);
+
+uint64_t rand_next(struct rand_state *state);
+
+/* uniform in [0, n), n > 0 */
+uint64_t rand_below(struct rand_state *state, uint64_t n);
+
 uint64_t rand_uint64();
 
 int rand_int(int i);
@@ -41,6 +95,8 @@ int find_char(char *s, char c);
 
 int string_is_int(char *s);
 
+uint64_t string_to_bytes(char *t);
+
 void merge_sort(move *arr, int16_t *val, unsigned int start, unsigned int end, int increasing);
 
 void merge(move *arr, int16_t *val, unsigned int first, unsigned int last, int increasing);
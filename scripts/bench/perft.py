@@ -8,13 +8,13 @@ from pathlib import Path
 date = datetime.now()
 date = date.strftime("%y%m%d-%H%M%S")
 
-def perft(fen, depth):
+def perft(fen, depth, flags):
     # arguments list
     depth = str(depth)
     fen_as_list = fen.split()
     args = [ "./bitbit", "setpos" ]
     args.extend(fen_as_list)
-    args.extend([ ",", "perft", "-t", depth, ",", "exit" ])
+    args.extend([ ",", "perft", "-t" + flags, depth, ",", "exit" ])
 
     # start process
     bitbit = subprocess.run(args,
@@ -27,7 +27,7 @@ def perft(fen, depth):
     out += bitbit.stdout[bitbit.stdout.find("nodes"):]
     return out
 
-def perft_bench(depth):
+def perft_bench(depth, flags):
     # <https://www.chessprogramming.org/Perft_Results>
     perft_arr = [ 
                   "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",                  0,
@@ -42,13 +42,19 @@ def perft_bench(depth):
     Path("scripts/results").mkdir(parents = True, exist_ok = True)
     file = open("scripts/results/perft-" + date + ".txt", "w")
     for i in range(int(len(perft_arr) / 2)):
-        out = perft(perft_arr[2 * i], depth + perft_arr[2 * i + 1])
+        out = perft(perft_arr[2 * i], depth + perft_arr[2 * i + 1], flags)
         file.write(out + "\n")
 
+# -h uses the perft hash table
+flags = ""
+if "-h" in sys.argv:
+    flags += "h"
+    sys.argv.remove("-h")
+
 depth = 6
 if len(sys.argv) > 1:
     if sys.argv[1].isdigit():
         if int(sys.argv[1]) > 1:
             depth = int(sys.argv[1])
 
-perft_bench(depth)
+perft_bench(depth, flags)
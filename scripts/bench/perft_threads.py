@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import subprocess
+from datetime import datetime
+from pathlib import Path
+
+date = datetime.now()
+date = date.strftime("%y%m%d-%H%M%S")
+
+def perft(fen, depth, threads):
+    # arguments list
+    fen_as_list = fen.split()
+    args = [ "./bitbit", "setpos" ]
+    args.extend(fen_as_list)
+    args.extend([ ",", "perft", "-jp", str(depth), str(threads), ",", "exit" ])
+
+    # start process
+    bitbit = subprocess.run(args,
+                            universal_newlines = True,
+                            stdout = subprocess.PIPE)
+
+    # get nodes and wall time of the last depth
+    line = [ l for l in bitbit.stdout.splitlines() if l.startswith("perft ") ][-1]
+    fields = dict(f.split("=") for f in line.split()[1:])
+    return int(fields["nodes"]), int(fields["time_ns"]) / 1000000000
+
+def perft_scaling(depth, max_threads):
+    # <https://www.chessprogramming.org/Perft_Results>
+    fen = "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"
+
+    Path("scripts/results").mkdir(parents = True, exist_ok = True)
+    file = open("scripts/results/perft-threads-" + date + ".txt", "w")
+    out = "position: " + fen + "\n"
+    out += "depth: " + str(depth) + "\n"
+    out += "threads      time      mnps   speedup efficiency\n"
+    file.write(out)
+    print(out, end = "")
+
+    base = None
+    threads = 1
+    while threads <= max_threads:
+        nodes, time = perft(fen, depth, threads)
+        if base is None:
+            base = time
+        speedup = base / time if time else 0
+        out = "%7i %9.2f %9.2f %9.2f %9.2f%%\n" % (threads, time,
+                nodes / time / 1000000 if time else 0,
+                speedup, 100 * speedup / threads)
+        file.write(out)
+        print(out, end = "")
+        threads *= 2
+
+depth = 5
+if len(sys.argv) > 1:
+    if sys.argv[1].isdigit():
+        if int(sys.argv[1]) > 1:
+            depth = int(sys.argv[1])
+
+max_threads = os.cpu_count()
+if len(sys.argv) > 2:
+    if sys.argv[2].isdigit():
+        if int(sys.argv[2]) > 0:
+            max_threads = int(sys.argv[2])
+
+perft_scaling(depth, max_threads)
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import subprocess
+from datetime import datetime
+from pathlib import Path
+
+date = datetime.now()
+date = date.strftime("%y%m%d-%H%M%S")
+
+# <https://www.chessprogramming.org/Perft_Results>
+positions = [
+    ("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", 6),
+    ("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", 5),
+    ("8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 7),
+    ("r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", 5),
+]
+
+# popcnt uses magics and bmi2 uses pext, both with hardware popcount
+backends = [ "generic", "popcnt", "bmi2" ]
+
+def perft(backend, fen, depth):
+    # arguments list
+    fen_as_list = fen.split()
+    args = [ "./bitbit", "setpos" ]
+    args.extend(fen_as_list)
+    args.extend([ ",", "perft", "-p", str(depth), ",", "exit" ])
+
+    # start process
+    env = dict(os.environ, BITBIT_KERNEL = backend)
+    bitbit = subprocess.run(args,
+                            universal_newlines = True,
+                            stdout = subprocess.PIPE,
+                            env = env)
+
+    # get nodes and time of the last depth
+    line = [ l for l in bitbit.stdout.splitlines() if l.startswith("perft ") ][-1]
+    fields = dict(f.split("=") for f in line.split()[1:])
+    return int(fields["nodes"]), int(fields["time_ns"]) / 1000000000
+
+def compare(runs):
+    Path("scripts/results").mkdir(parents = True, exist_ok = True)
+
+    file = open("scripts/results/slider-backend-" + date + ".txt", "w")
+    out = "runs: " + str(runs) + ", best time is kept\n"
+    out += "position                                                                     depth" + "".join("%10s" % b for b in backends) + "\n"
+    file.write(out)
+    print(out, end = "")
+
+    total_nodes = 0
+    total_time = { backend: 0 for backend in backends }
+    for fen, depth in positions:
+        best = { backend: None for backend in backends }
+        # alternate the backends so that all see the same machine state
+        for i in range(runs):
+            for backend in backends:
+                nodes, time = perft(backend, fen, depth)
+                if best[backend] is None or time < best[backend]:
+                    best[backend] = time
+        total_nodes += nodes
+        out = "%-76s %5i" % (fen, depth)
+        for backend in backends:
+            total_time[backend] += best[backend]
+            out += "%10.2f" % (nodes / best[backend] / 1000000 if best[backend] else 0)
+        out += "\n"
+        file.write(out)
+        print(out, end = "")
+
+    out = "%-82s" % "total mnps"
+    for backend in backends:
+        out += "%10.2f" % (total_nodes / total_time[backend] / 1000000 if total_time[backend] else 0)
+    out += "\n"
+    file.write(out)
+    print(out, end = "")
+
+runs = 3
+if len(sys.argv) > 1:
+    if sys.argv[1].isdigit():
+        if int(sys.argv[1]) > 0:
+            runs = int(sys.argv[1])
+
+compare(runs)
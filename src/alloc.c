@@ -0,0 +1,93 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "alloc.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/mman.h>
+
+#define HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+static inline size_t huge_page_round(size_t size) {
+	return (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+}
+
+void *alloc_large(size_t size, int *pages) {
+	size_t rounded = huge_page_round(size);
+	void *ptr;
+
+#ifdef MAP_HUGETLB
+	/* only succeeds if huge pages have been reserved by the system */
+	ptr = mmap(NULL, rounded, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	if (ptr != MAP_FAILED) {
+		*pages = PAGES_HUGETLB;
+		return ptr;
+	}
+#endif
+
+	/* transparent huge pages need a 2 MiB aligned range, map an extra
+	 * huge page and unmap what is outside the aligned range.
+	 */
+	char *raw = mmap(NULL, rounded + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (raw == MAP_FAILED)
+		return NULL;
+	char *aligned = (char *)(((uintptr_t)raw + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+	if (aligned > raw)
+		munmap(raw, aligned - raw);
+	munmap(aligned + rounded, raw + HUGE_PAGE_SIZE - aligned);
+
+	*pages = PAGES_NORMAL;
+#ifdef MADV_HUGEPAGE
+	if (!madvise(aligned, rounded, MADV_HUGEPAGE))
+		*pages = PAGES_TRANSPARENT;
+#endif
+	return aligned;
+}
+
+void free_large(void *ptr, size_t size) {
+	if (ptr)
+		munmap(ptr, huge_page_round(size));
+}
+
+const char *alloc_pages_string(int pages) {
+	switch (pages) {
+	case PAGES_HUGETLB:
+		return "huge";
+	case PAGES_TRANSPARENT:
+		return "transparent huge";
+	default:
+		return "normal";
+	}
+}
+
+int64_t alloc_anon_huge_kib() {
+	char line[128];
+	int64_t kib = -1;
+	FILE *f = fopen("/proc/self/smaps_rollup", "r");
+	if (!f)
+		return -1;
+	while (fgets(line, sizeof(line), f))
+		if (sscanf(line, "AnonHugePages: %" SCNd64, &kib) == 1)
+			break;
+	fclose(f);
+	return kib;
+}
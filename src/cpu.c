@@ -0,0 +1,56 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "cpu.h"
+
+#include <string.h>
+
+int cpu_features = 0;
+
+void cpu_init() {
+	cpu_features = 0;
+#if __GNUC__ && (__x86_64__ || __i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("popcnt"))
+		cpu_features |= CPU_POPCNT;
+	if (__builtin_cpu_supports("bmi"))
+		cpu_features |= CPU_BMI1;
+	if (__builtin_cpu_supports("bmi2"))
+		cpu_features |= CPU_BMI2;
+	if (__builtin_cpu_supports("avx2"))
+		cpu_features |= CPU_AVX2;
+	if (__builtin_cpu_is("amdfam15h") || __builtin_cpu_is("amdfam17h"))
+		cpu_features |= CPU_SLOW_PEXT;
+#endif
+}
+
+char *cpu_string(char *str) {
+	str[0] = '\0';
+	if (cpu_has(CPU_POPCNT))
+		strcat(str, " popcnt");
+	if (cpu_has(CPU_BMI1))
+		strcat(str, " bmi1");
+	if (cpu_has(CPU_BMI2))
+		strcat(str, cpu_has(CPU_SLOW_PEXT) ? " bmi2 (slow pext)" : " bmi2");
+	if (cpu_has(CPU_AVX2))
+		strcat(str, " avx2");
+	if (!str[0])
+		strcpy(str, " none");
+	/* skip the leading space */
+	memmove(str, str + 1, strlen(str));
+	return str;
+}
@@ -19,92 +19,14 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "move_gen.h"
+#include "move_picker.h"
 #include "move.h"
 #include "util.h"
 #include "hash_table.h"
-#include "init.h"
-
-int eval_table[13][64];
-
-int piece_value[6] = { 100, 300, 315, 500, 900, 0 };
-
-int white_side_eval_table[6][64] = {
-	{
-		  0,   0,   0,   0,   0,   0,   0,   0,
-		 50,  50,  50,  50,  50,  50,  50,  50,
-		 10,  10,  20,  30,  30,  20,  10,  10,
-		  5,   5,  10,  25,  25,  10,   5,   5,
-		  0,   0,   0,  20,  20,   0,   0,   0,
-		  5,  -5, -10,   0,   0, -10,  -5,   5,
-		  5,  10,  10, -20, -20,  10,  10,   5,
-		  0,   0,   0,   0,   0,   0,   0,   0
-	}, {
-		-50, -40, -30, -30, -30, -30, -40, -50,
-		-40, -20,   0,   0,   0,   0, -20, -40,
-		-30,   0,  10,  15,  15,  10,   0, -30,
-		-30,   5,  15,  20,  20,  15,   5, -30,
-		-30,   0,  15,  20,  20,  15,   0, -30,
-		-30,   5,  10,  15,  15,  10,   5, -30,
-		-40, -20,   0,   5,   5,   0, -20, -40,
-		-50, -40, -30, -30, -30, -30, -40, -50
-	}, {
-		-20, -10, -10, -10, -10, -10, -10, -20,
-		-10,   0,   0,   0,   0,   0,   0, -10,
-		-10,   0,   5,  10,  10,   5,   0, -10,
-		-10,   5,   5,  10,  10,   5,   5, -10,
-		-10,   0,  10,  10,  10,  10,   0, -10,
-		-10,  10,  10,  10,  10,  10,  10, -10,
-		-10,   5,   0,   0,   0,   0,   5, -10,
-		-20, -10, -10, -10, -10, -10, -10, -20
-	}, {
-		  0,   0,   0,   0,   0,   0,   0,   0,
-		  5,  10,  10,  10,  10,  10,  10,   5,
-		 -5,   0,   0,   0,   0,   0,   0,  -5,
-		 -5,   0,   0,   0,   0,   0,   0,  -5,
-		 -5,   0,   0,   0,   0,   0,   0,  -5,
-		 -5,   0,   0,   0,   0,   0,   0,  -5,
-		 -5,   0,   0,   0,   0,   0,   0,  -5,
-		  0,   0,   0,   5,   5,   0,   0,   0
-	}, {
-		-20, -10, -10,  -5,  -5, -10, -10, -20,
-		-10,   0,   0,   0,   0,   0,   0, -10,
-		-10,   0,   5,   5,   5,   5,   0, -10,
-		 -5,   0,   5,   5,   5,   5,   0,  -5,
-		  0,   0,   5,   5,   5,   5,   0,  -5,
-		-10,   5,   5,   5,   5,   5,   0, -10,
-		-10,   0,   5,   0,   0,   0,   0, -10,
-		-20, -10, -10,  -5,  -5, -10, -10, -20
-	}, {
-		-30, -40, -40, -50, -50, -40, -40, -30,
-		-30, -40, -40, -50, -50, -40, -40, -30,
-		-30, -40, -40, -50, -50, -40, -40, -30,
-		-30, -40, -40, -50, -50, -40, -40, -30,
-		-20, -30, -30, -40, -40, -30, -30, -20,
-		-10, -20, -20, -20, -20, -20, -20, -10,
-		 20,  20,   0,   0,   0,   0,  20,  20,
-		 20,  30,  10,   0,   0,  10,  30,  20
-	}
-
-};
-
-void evaluate_init() {
-	for (int i = 0; i < 13; i++) {
-		for (int j  = 0; j < 64; j++) {
-			if (i == 0)
-				eval_table[i][j] = 0;
-			else if (i < 7) {
-				eval_table[i][j] = white_side_eval_table[i - 1][(7 - j / 8) * 8 + (j % 8)] +
-					           piece_value[i - 1];
-			}
-			else
-				eval_table[i][j] = -white_side_eval_table[i - 7][j] -
-						   piece_value[i - 7];
-			init_status("populating evaluation lookup table");
-		}
-	}
-}
+#include "timer.h"
 
 int count_position(struct position *pos) {
 	int eval = 0;
@@ -114,60 +36,92 @@ int count_position(struct position *pos) {
 	return eval;
 }
 
+/* every call to the recursive evaluation counts as a node */
+uint64_t evaluate_nodes = 0;
+
+move killer_move[256][2];
+
+static inline int16_t evaluate_leaf(struct position *pos) {
+	int16_t evaluation;
+	PROFILE_CALL(PROFILE_EVALUATE, evaluation = count_position(pos));
+	return evaluation;
+}
+
+static inline move evaluate_next_move(struct move_picker *mp) {
+	move m;
+	PROFILE_CALL(PROFILE_MOVEGEN, m = move_picker_next(mp));
+	return m;
+}
+
 int16_t evaluate_recursive(struct position *pos, uint8_t depth, int alpha, int beta) {
+	evaluate_nodes++;
 	if (depth <= 0)
-		return count_position(pos);
+		return evaluate_leaf(pos);
 
 	int16_t evaluation;
-	move move_list[256];
-	generate_all(pos, move_list);
+	struct move_picker mp;
+	struct undo u;
+	move m;
+	move_picker_init(&mp, pos, 0, killer_move[depth]);
 
 	if (pos->turn) {
 		evaluation = -0x8000;
-		for (move *move_ptr = move_list; *move_ptr; move_ptr++) {
-			do_move(pos, move_ptr);
+		while ((m = evaluate_next_move(&mp))) {
+			PROFILE_CALL(PROFILE_MAKEMOVE, do_move(pos, &m, &u));
 			evaluation = MAX(evaluation, evaluate_recursive(pos, depth - 1, alpha, beta));
-			undo_move(pos, move_ptr);
+			PROFILE_CALL(PROFILE_MAKEMOVE, undo_move(pos, &m, &u));
 			alpha = MAX(evaluation, alpha);
-			if (beta < alpha)
+			if (beta < alpha) {
+				if (!move_is_tactical(pos, m))
+					store_killer(killer_move[depth], m);
 				break;
+			}
 		}
 	}
 	else {
 		evaluation = 0x7FFF;
-		for (move *move_ptr = move_list; *move_ptr; move_ptr++) {
-			do_move(pos, move_ptr);
+		while ((m = evaluate_next_move(&mp))) {
+			PROFILE_CALL(PROFILE_MAKEMOVE, do_move(pos, &m, &u));
 			evaluation = MIN(evaluation, evaluate_recursive(pos, depth - 1, alpha, beta));
-			undo_move(pos, move_ptr);
+			PROFILE_CALL(PROFILE_MAKEMOVE, undo_move(pos, &m, &u));
 			beta = MIN(evaluation, beta);
-			if (beta < alpha)
+			if (beta < alpha) {
+				if (!move_is_tactical(pos, m))
+					store_killer(killer_move[depth], m);
 				break;
+			}
 		}
 	}
 	return evaluation;
 }
 
-int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose) {
+int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose, int timing) {
 	if (depth <= 0)
-		return count_position(pos);
+		return evaluate_leaf(pos);
 
 	int16_t evaluation;
 	int16_t evaluation_list[256];
 	move move_list[256];
+	struct undo u;
 	generate_all(pos, move_list);
 
+	memset(killer_move, 0, sizeof(killer_move));
+
 	int i;
 	int16_t alpha, beta;
+	uint64_t nodes, t;
 	for (int d = 1; d <= depth; d++) {
+		nodes = evaluate_nodes;
+		t = time_ns();
 		alpha = -0x8000;
 		beta = 0x7FFF;
 		if (pos->turn) {
 			evaluation = -0x8000;
 			for (i = 0; move_list[i]; i++) {
-				do_move(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, do_move(pos, move_list + i, &u));
 				evaluation_list[i] = evaluate_recursive(pos, d - 1, alpha, beta);
 				evaluation = MAX(evaluation, evaluation_list[i]);
-				undo_move(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, undo_move(pos, move_list + i, &u));
 				alpha = MAX(evaluation, alpha);
 				if (beta < alpha) {
 					i++;
@@ -179,10 +133,10 @@ int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose) {
 		else {
 			evaluation = 0x7FFF;
 			for (i = 0; move_list[i]; i++) {
-				do_move(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, do_move(pos, move_list + i, &u));
 				evaluation_list[i] = evaluate_recursive(pos, d - 1, alpha, beta);
 				evaluation = MIN(evaluation, evaluation_list[i]);
-				undo_move(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, undo_move(pos, move_list + i, &u));
 				beta = MIN(evaluation, beta);
 				if (beta < alpha) {
 					i++;
@@ -194,78 +148,150 @@ int16_t evaluate(struct position *pos, uint8_t depth, move *m, int verbose) {
 		if (verbose) {
 			printf("[%i/%i] %.2f ", d, depth, (double)evaluation / 100);
 			print_move(move_list);
-			printf("       \r");
+			printf(timing ? "\n" : "       \r");
 			fflush(stdout);
 		}
+		if (timing)
+			timer_print(timing, "eval", d, evaluate_nodes - nodes, time_ns() - t);
 		if (m)
 			*m = *move_list;
 	}
 
-	if (verbose)
+	if (verbose && !timing)
 		printf("\n");
 	return evaluation;
 }
 
+/* whether the entry decides the evaluation in the window alpha, beta */
+static inline int hash_cutoff(const struct hash_entry *entry, int16_t alpha, int16_t beta) {
+	switch (entry_bound(entry)) {
+	case BOUND_EXACT:
+		return 1;
+	case BOUND_LOWER:
+		return entry->evaluation >= beta;
+	case BOUND_UPPER:
+		return entry->evaluation <= alpha;
+	default:
+		return 0;
+	}
+}
+
+/* alpha < beta on every call, a node is cut off as soon as the window
+ * is empty. A result at or below the original alpha is an upper bound,
+ * at or above the original beta a lower bound.
+ */
 int16_t evaluate_recursive_hash(struct position *pos, uint8_t depth, int16_t alpha, int16_t beta) {
+	evaluate_nodes++;
 	if (depth <= 0)
-		return count_position(pos);
+		return evaluate_leaf(pos);
 
-	if (table_entry(pos)->depth >= depth && table_entry(pos)->zobrist_key == pos->zobrist_key)
-		return table_entry(pos)->evaluation;
+	move hash_move = 0;
+	struct hash_bucket *bucket = hash_table_bucket(pos->zobrist_key);
+	struct hash_entry entry;
+	int hit = bucket_entry(bucket, pos, &entry);
+	if (hit) {
+		if (entry.depth >= depth && hash_cutoff(&entry, alpha, beta))
+			return entry.evaluation;
+		hash_move = entry.move;
+	}
 
-	int16_t evaluation;
-	move move_list[256];
-	generate_all(pos, move_list);
+	/* children at depth 0 never probe the table, their buckets are not
+	 * prefetched.
+	 */
+	int16_t alpha_original = alpha, beta_original = beta;
+	int16_t evaluation, e;
+	struct move_picker mp;
+	struct undo u;
+	move m, best = 0;
+	move_picker_init(&mp, pos, hash_move, killer_move[depth]);
 
 	if (pos->turn) {
 		evaluation = -0x8000;
-		for (move *move_ptr = move_list; *move_ptr; move_ptr++) {
-			do_move_zobrist(pos, move_ptr);
-			evaluation = MAX(evaluation, evaluate_recursive_hash(pos, depth - 1, alpha, beta));
-			undo_move_zobrist(pos, move_ptr);
+		while ((m = evaluate_next_move(&mp))) {
+			PROFILE_CALL(PROFILE_MAKEMOVE, depth > 1 ? do_move_prefetch(pos, &m, &u) : do_move_zobrist(pos, &m, &u));
+			e = evaluate_recursive_hash(pos, depth - 1, alpha, beta);
+			PROFILE_CALL(PROFILE_MAKEMOVE, undo_move_zobrist(pos, &m, &u));
+			if (e > evaluation) {
+				evaluation = e;
+				best = m;
+			}
 			alpha = MAX(evaluation, alpha);
-			if (beta < alpha)
+			if (beta <= alpha) {
+				if (!move_is_tactical(pos, m))
+					store_killer(killer_move[depth], m);
 				break;
+			}
 		}
 	}
 	else {
 		evaluation = 0x7FFF;
-		for (move *move_ptr = move_list; *move_ptr; move_ptr++) {
-			do_move_zobrist(pos, move_ptr);
-			evaluation = MIN(evaluation, evaluate_recursive_hash(pos, depth - 1, alpha, beta));
-			undo_move_zobrist(pos, move_ptr);
+		while ((m = evaluate_next_move(&mp))) {
+			PROFILE_CALL(PROFILE_MAKEMOVE, depth > 1 ? do_move_prefetch(pos, &m, &u) : do_move_zobrist(pos, &m, &u));
+			e = evaluate_recursive_hash(pos, depth - 1, alpha, beta);
+			PROFILE_CALL(PROFILE_MAKEMOVE, undo_move_zobrist(pos, &m, &u));
+			if (e < evaluation) {
+				evaluation = e;
+				best = m;
+			}
 			beta = MIN(evaluation, beta);
-			if (beta < alpha)
+			if (beta <= alpha) {
+				if (!move_is_tactical(pos, m))
+					store_killer(killer_move[depth], m);
 				break;
+			}
 		}
 	}
-	store_table_entry(pos, evaluation, depth);
+
+	int bound;
+	if (evaluation <= alpha_original)
+		bound = BOUND_UPPER;
+	else if (evaluation >= beta_original)
+		bound = BOUND_LOWER;
+	else
+		bound = BOUND_EXACT;
+	/* when white fails low or black fails high no move is known to be
+	 * better than the others.
+	 */
+	if ((pos->turn && bound == BOUND_UPPER) || (!pos->turn && bound == BOUND_LOWER))
+		best = 0;
+	/* the static evaluation is only needed for the store, it is kept
+	 * from the old entry if there is one.
+	 */
+	store_bucket_entry(bucket, pos, evaluation, hit ? entry.static_evaluation : count_position(pos), depth, bound, best);
 	return evaluation;
 }
 
-int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose) {
+int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose, int timing) {
 	if (depth <= 0)
-		return count_position(pos);
+		return evaluate_leaf(pos);
 
 	int16_t evaluation;
 	int16_t evaluation_list[256];
 	move move_list[256];
+	struct undo u;
 	generate_all(pos, move_list);
+	int16_t static_evaluation = count_position(pos);
+
+	memset(killer_move, 0, sizeof(killer_move));
+	hash_table_new_search();
 
 	int i;
 	int16_t alpha, beta;
+	uint64_t nodes, t;
 	for (int d = 1; d <= depth; d++) {
+		nodes = evaluate_nodes;
+		t = time_ns();
 		alpha = -0x8000;
 		beta = 0x7FFF;
 		if (pos->turn) {
 			evaluation = -0x8000;
 			for (i = 0; move_list[i]; i++) {
-				do_move_zobrist(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, d > 1 ? do_move_prefetch(pos, move_list + i, &u) : do_move_zobrist(pos, move_list + i, &u));
 				evaluation_list[i] = evaluate_recursive_hash(pos, d - 1, alpha, beta);
 				evaluation = MAX(evaluation, evaluation_list[i]);
-				undo_move_zobrist(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, undo_move_zobrist(pos, move_list + i, &u));
 				alpha = MAX(evaluation, alpha);
-				if (beta < alpha) {
+				if (beta <= alpha) {
 					i++;
 					break;
 				}
@@ -275,12 +301,12 @@ int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose)
 		else {
 			evaluation = 0x7FFF;
 			for (i = 0; move_list[i]; i++) {
-				do_move_zobrist(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, d > 1 ? do_move_prefetch(pos, move_list + i, &u) : do_move_zobrist(pos, move_list + i, &u));
 				evaluation_list[i] = evaluate_recursive_hash(pos, d - 1, alpha, beta);
 				evaluation = MIN(evaluation, evaluation_list[i]);
-				undo_move_zobrist(pos, move_list + i);
+				PROFILE_CALL(PROFILE_MAKEMOVE, undo_move_zobrist(pos, move_list + i, &u));
 				beta = MIN(evaluation, beta);
-				if (beta < alpha) {
+				if (beta <= alpha) {
 					i++;
 					break;
 				}
@@ -291,15 +317,17 @@ int16_t evaluate_hash(struct position *pos, uint8_t depth, move *m, int verbose)
 		if (verbose) {
 			printf("\r[%i/%i] %.2f ", d, depth, (double)evaluation / 100);
 			print_move(move_list);
-			printf("       \r");
+			printf(timing ? "\n" : "       \r");
 			fflush(stdout);
 		}
-		store_table_entry(pos, evaluation, d);
+		store_table_entry(pos, evaluation, static_evaluation, d, BOUND_EXACT, *move_list);
+		if (timing)
+			timer_print(timing, "eval", d, evaluate_nodes - nodes, time_ns() - t);
 		if (m)
 			*m = *move_list;
 	}
 
-	if (verbose)
+	if (verbose && !timing)
 		printf("\n");
 	return evaluation;
 }
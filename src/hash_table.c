@@ -19,9 +19,15 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <limits.h>
 
 #include "util.h"
 #include "init.h"
+#include "alloc.h"
+#include "table_cache.h"
+#include "timer.h"
 
 struct hash_table *hash_table = NULL;
 
@@ -29,67 +35,171 @@ struct hash_table *hash_table = NULL;
 #define HASH 64M
 #endif
 
+#define ZOBRIST_SEED 0x7A0B
+
+/* the size which the table has or will have when it is allocated */
+static uint64_t hash_size_bytes = 0;
+
 uint64_t hash_table_size_bytes() {
-	char t[] = MACRO_VALUE(HASH);
-	int i;
-	int flag;
-	uint64_t size;
-	for (size = 0, flag = 0, i = 0; t[i] != '\0'; i++) {
-		switch (t[i]) {
-		case 'G':
-			size *= 1024;
-			/* fallthrough */
-		case 'M':
-			size *= 1024;
-			/* fallthrough */
-		case 'K':
-			size *= 1024;
-			if (!flag) {
-				flag = 1;
-				break;
-			}
-			/* fallthrough */
-		case '0':
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':
-			if (!flag) {
-				size *= 10;
-				/* will return 0 anyway if t[i] is K, M, G */
-				size += find_char("0123456789", t[i]);
-				break;
-			}
-			/* fallthrough */
-		default:
-			return 0;
+	if (!hash_size_bytes)
+		hash_size_bytes = string_to_bytes(MACRO_VALUE(HASH));
+	return hash_size_bytes;
+}
+
+static inline uint16_t table_key(struct position *pos) {
+	return pos->zobrist_key;
+}
+
+static inline uint64_t entry_data(const struct hash_entry *entry) {
+	uint64_t data;
+	memcpy(&data, entry, sizeof(data));
+	return data;
+}
+
+static inline void data_entry(struct hash_entry *entry, uint64_t data) {
+	memcpy(entry, &data, sizeof(data));
+}
+
+static inline uint16_t data_check(uint64_t data, uint16_t key) {
+	return key ^ data ^ data >> 16 ^ data >> 32 ^ data >> 48;
+}
+
+int bucket_entry(struct hash_bucket *bucket, struct position *pos, struct hash_entry *entry) {
+	uint16_t key = table_key(pos);
+	uint64_t data;
+	uint16_t check;
+	for (int i = 0; i < HASH_BUCKET_ENTRIES; i++) {
+		data = __atomic_load_n(bucket->data + i, __ATOMIC_RELAXED);
+		check = __atomic_load_n(bucket->check + i, __ATOMIC_RELAXED);
+		if (check != data_check(data, key))
+			continue;
+		data_entry(entry, data);
+		if (entry->depth)
+			return 1;
+	}
+	return 0;
+}
+
+/* empty entries first, then shallow entries of old searches. An entry
+ * is worth 8 plies less for every search since it was stored.
+ */
+static inline int replace_value(struct hash_entry *entry) {
+	if (!entry->depth)
+		return INT_MIN;
+	return entry->depth - 8 * ((hash_table->generation - entry_generation(entry)) & (HASH_GENERATIONS - 1));
+}
+
+void store_bucket_entry(struct hash_bucket *bucket, struct position *pos, int16_t evaluation, int16_t static_evaluation, int8_t depth, int bound, uint16_t best_move) {
+	uint16_t key = table_key(pos);
+	struct hash_entry entry, old;
+	uint64_t data;
+	uint16_t check, old_move = 0;
+	int index = 0, value, best_value = INT_MAX;
+	for (int i = 0; i < HASH_BUCKET_ENTRIES; i++) {
+		data = __atomic_load_n(bucket->data + i, __ATOMIC_RELAXED);
+		check = __atomic_load_n(bucket->check + i, __ATOMIC_RELAXED);
+		data_entry(&old, data);
+		/* the same position is always overwritten */
+		if (old.depth && check == data_check(data, key)) {
+			index = i;
+			old_move = old.move;
+			break;
+		}
+		value = replace_value(&old);
+		if (value < best_value) {
+			index = i;
+			best_value = value;
 		}
 	}
-	return size;
+	/* keep the old move of the position if there is no new one */
+	entry.move = best_move ? best_move : old_move;
+	entry.evaluation = evaluation;
+	entry.static_evaluation = static_evaluation;
+	entry.depth = depth;
+	entry.bound_generation = bound | hash_table->generation << 2;
+	data = entry_data(&entry);
+	__atomic_store_n(bucket->data + index, data, __ATOMIC_RELAXED);
+	__atomic_store_n(bucket->check + index, data_check(data, key), __ATOMIC_RELAXED);
 }
 
-struct hash_entry *table_entry(struct position *pos) {
-	return hash_table->table + (pos->zobrist_key % hash_table->size);
+int table_entry(struct position *pos, struct hash_entry *entry) {
+	return bucket_entry(hash_table_bucket(pos->zobrist_key), pos, entry);
 }
 
-void store_table_entry(struct position *pos, int16_t evaluation, int8_t depth) {
-	table_entry(pos)->evaluation = evaluation;
-	table_entry(pos)->depth = depth;
-	table_entry(pos)->zobrist_key = pos->zobrist_key;
+void store_table_entry(struct position *pos, int16_t evaluation, int16_t static_evaluation, int8_t depth, int bound, uint16_t best_move) {
+	store_bucket_entry(hash_table_bucket(pos->zobrist_key), pos, evaluation, static_evaluation, depth, bound, best_move);
 }
 
 uint64_t hash_table_size() {
 	return hash_table->size;
 }
 
+/* an entry of zeros is empty */
 void hash_table_clear() {
-	for (uint64_t i = 0; i < hash_table->size; i++)
-		(hash_table->table + i)->depth = -1;
+	memset(hash_table->table, 0, hash_table->size * sizeof(struct hash_bucket));
+	hash_table->generation = 0;
+}
+
+void hash_table_new_search() {
+	hash_table->generation = (hash_table->generation + 1) & (HASH_GENERATIONS - 1);
+}
+
+/* the new table comes zeroed from alloc_large, its pages are only
+ * touched when they are first used. The old table is kept if the
+ * allocation fails.
+ */
+int hash_table_resize(uint64_t bytes) {
+	if (bytes < sizeof(struct hash_bucket)) {
+		printf("error: bad hash table size\n");
+		return 1;
+	}
+	if (hash_table) {
+		int pages;
+		uint64_t size = bytes / sizeof(struct hash_bucket);
+		struct hash_bucket *table = alloc_large(size * sizeof(struct hash_bucket), &pages);
+		if (!table) {
+			printf("error: could not allocate %" PRIu64 "B\n", bytes);
+			return 1;
+		}
+		free_large(hash_table->table, hash_table->size * sizeof(struct hash_bucket));
+		hash_table->table = table;
+		hash_table->size = size;
+		hash_table->pages = pages;
+	}
+	hash_size_bytes = bytes;
+	return 0;
+}
+
+/* each step depends on the one before so that the latencies add up
+ * instead of overlapping. The results are summed so that no loop is
+ * optimized away.
+ */
+void hash_table_bench(uint64_t count) {
+	const uint64_t m = 0x5851F42D4C957F2D;
+	uint64_t key, sum = 0, t;
+	uint64_t i;
+
+	key = 1;
+	t = time_ns();
+	for (i = 0; i < count; i++)
+		key = (key ^ (key % hash_table->size)) * m + 1;
+	sum += key;
+	printf("index modulo: %.2f ns\n", (double)(time_ns() - t) / count);
+
+	key = 1;
+	t = time_ns();
+	for (i = 0; i < count; i++)
+		key = (key ^ mul_hi64(key, hash_table->size)) * m + 1;
+	sum += key;
+	printf("index multiply high: %.2f ns\n", (double)(time_ns() - t) / count);
+
+	key = 1;
+	t = time_ns();
+	for (i = 0; i < count; i++)
+		key = (key ^ hash_table_bucket(key)->check[0]) * m + 1;
+	sum += key;
+	printf("probe: %.2f ns\n", (double)(time_ns() - t) / count);
+	printf("checksum: %" PRIu64 "\n", sum);
 }
 
 uint64_t zobrist_piece_key(int piece, int square) {
@@ -110,21 +220,34 @@ uint64_t zobrist_en_passant_key(int square) {
 
 int hash_table_init() {
 	uint64_t t = hash_table_size_bytes();
-	if (t < sizeof(struct hash_entry)) {
+	if (t < sizeof(struct hash_bucket)) {
 		printf("\33[2Kfatal error: bad hash table size\n");
 		return 1;
 	}
 
-	hash_table = malloc(sizeof(struct hash_table));
-	hash_table->size = t / sizeof(struct hash_entry);
-	hash_table->table = malloc(hash_table->size * sizeof(struct hash_entry));
-
-	hash_table_clear();
+	hash_table = calloc(1, sizeof(struct hash_table));
+	if (!hash_table) {
+		printf("\33[2Kfatal error: out of memory\n");
+		return 1;
+	}
+	hash_table->size = t / sizeof(struct hash_bucket);
+	hash_table->table = alloc_large(hash_table->size * sizeof(struct hash_bucket), &hash_table->pages);
+	if (!hash_table->table) {
+		printf("\33[2Kfatal error: could not allocate the hash table\n");
+		return 1;
+	}
 
-	hash_table->zobrist_key = malloc((12 * 64 + 1 + 16 + 8) * sizeof(uint64_t));
+	hash_table->zobrist_key = malloc(ZOBRIST_KEYS * sizeof(uint64_t));
 
-	for (int i = 0; i < 12 * 64 + 1 + 16 + 8; i++) {
-		hash_table->zobrist_key[i] = rand_uint64();
+	/* the keys have their own state so that they do not depend on what
+	 * else is random, every process which maps the table file uses the
+	 * same keys.
+	 */
+	struct rand_state state;
+	rand_seed(&state, ZOBRIST_SEED);
+	const uint64_t *cached = table_cache_zobrist();
+	for (int i = 0; i < ZOBRIST_KEYS; i++) {
+		hash_table->zobrist_key[i] = cached ? cached[i] : rand_next(&state);
 		init_status("generating zobrist keys");
 	}
 	return 0;
@@ -133,7 +256,7 @@ int hash_table_init() {
 void hash_table_term() {
 	if (hash_table) {
 		free(hash_table->zobrist_key);
-		free(hash_table->table);
+		free_large(hash_table->table, hash_table->size * sizeof(struct hash_bucket));
 	}
 	free(hash_table);
 }
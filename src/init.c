@@ -23,8 +23,12 @@
 #include <time.h>
 
 #include "interface.h"
+#include "hash_table.h"
+#include "magic_bitboard.h"
+#include "util.h"
 
 #define PRINT_DELAY_MS 1
+#define CLOCK_INTERVAL 256
 
 struct counter {
 	uint64_t done;
@@ -34,15 +38,34 @@ struct counter {
 
 struct counter *counter = NULL;
 
-int init(int argc, char **argv) {
-	if (argc > 1) {
-		if (strcmp(argv[1], "--version") == 0) {
+/* handles the options before the commands and removes them from argv */
+int init(int *argc, char ***argv) {
+	int i;
+	for (i = 1; i < *argc && strncmp((*argv)[i], "--", 2) == 0; i++) {
+		if (strcmp((*argv)[i], "--version") == 0) {
 			interface_version(NULL);
 			return 1;
 		}
+		else if (strcmp((*argv)[i], "--hash") == 0 && i + 1 < *argc) {
+			i++;
+			if (hash_table_resize(string_to_bytes((*argv)[i])))
+				return 1;
+		}
+		else {
+			printf("error: unknown option %s\n", (*argv)[i]);
+			return 1;
+		}
 	}
+	/* keep the program name in front of the commands */
+	(*argv)[i - 1] = (*argv)[0];
+	*argv += i - 1;
+	*argc -= i - 1;
+
 	counter = malloc(sizeof(struct counter));
-	counter->total = 365699;
+	/* init and util_init, the attack masks and table of
+	 * magic_bitboard_init and the keys of hash_table_init.
+	 */
+	counter->total = 2 + 64 + SLIDING_ATTACKS_SIZE + ZOBRIST_KEYS;
 	counter->done = 0;
 	counter->time = clock();
 	init_status("init");
@@ -60,6 +83,9 @@ void init_print(char *str) {
 
 void init_status(char *str) {
 	counter->done++;
+	/* clock is a system call, only check it every so often */
+	if (counter->done % CLOCK_INTERVAL)
+		return;
 	clock_t t = clock();
 	if (1000 * (t - counter->time) > CLOCKS_PER_SEC * PRINT_DELAY_MS) {
 		init_print(str);
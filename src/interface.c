@@ -13,22 +13,31 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#define _POSIX_C_SOURCE 199309L
+
 #include "interface.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
 #include <inttypes.h>
-#include <time.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "bitboard.h"
+#include "attack_gen.h"
 #include "util.h"
 #include "position.h"
 #include "move.h"
 #include "perft.h"
 #include "evaluate.h"
 #include "hash_table.h"
+#include "timer.h"
+#include "move_gen.h"
+#include "cpu.h"
+#include "magic_bitboard.h"
+#include "table_cache.h"
+#include "alloc.h"
 #include "version.h"
 
 struct func {
@@ -38,6 +47,7 @@ struct func {
 
 struct move_linked {
 	move *move;
+	struct undo undo;
 	struct move_linked *next;
 	struct move_linked *previous;
 };
@@ -75,6 +85,11 @@ void move_previous() {
 	}
 }
 
+/* -t prints timings for people, -p for scripts */
+static inline int timer_format(struct arg *arg) {
+	return arg->p ? TIMER_MACHINE : arg->t ? TIMER_HUMAN : 0;
+}
+
 int interface_help(struct arg *arg) {
 	UNUSED(arg);
 	printf(
@@ -85,8 +100,17 @@ int interface_help(struct arg *arg) {
 	"clear [-h]\n"
 	"setpos [-r] [fen]\n"
 	"domove [-fr] [move]\n"
-	"perft [-tv] [depth]\n"
-	"eval [-hmtv] [depth]\n"
+	"perft [-hjptv] [depth] [threads]\n"
+	"perftsplit [depth] [split] [units]\n"
+	"perftrun [-hjtv] [units] [results] [worker] [workers]\n"
+	"perftmerge [units] [results ...]\n"
+	"perftsuite [-hjv] [epd] [depth] [threads]\n"
+	"eval [-hmptv] [depth]\n"
+	"findmagics\n"
+	"legalcheck [positions]\n"
+	"memory\n"
+	"hash [size]\n"
+	"hashbench [probes]\n"
 	"print [-v]\n"
 	);
 	return 0;
@@ -100,7 +124,7 @@ int interface_domove(struct arg *arg) {
 	}
 	else if (arg->r) {
 		if (move_last) {
-			undo_move_zobrist(pos, move_last->move);
+			undo_move_zobrist(pos, move_last->move, &move_last->undo);
 			move_previous();
 		}
 		else {
@@ -113,7 +137,7 @@ int interface_domove(struct arg *arg) {
 	else {
 		move_next(string_to_move(pos, arg->argv[1]));
 		if (*(move_last->move)) {
-			do_move_zobrist(pos, move_last->move);
+			do_move_zobrist(pos, move_last->move, &move_last->undo);
 		}
 		else {
 			move_previous();
@@ -130,14 +154,32 @@ int interface_perft(struct arg *arg) {
 	}
 	else {
 		if (string_is_int(arg->argv[1])) {
-			clock_t t = clock();
-			uint64_t p = perft(pos, atoi(arg->argv[1]), 1, arg->v);
-			t = clock() - t;
-			if (arg->t) {
-				printf("time: %.2f\n", (double)t / CLOCKS_PER_SEC);
-				if (t != 0)
-					printf("mpns: %i\n", (int)(p * CLOCKS_PER_SEC / (t * 1000000)));
+			int threads = 1;
+			if (arg->j) {
+				if (arg->argc < 3)
+					threads = sysconf(_SC_NPROCESSORS_ONLN);
+				else if (string_is_int(arg->argv[2]) && atoi(arg->argv[2]) > 0)
+					threads = atoi(arg->argv[2]);
+				else
+					return 3;
 			}
+			int depth = atoi(arg->argv[1]);
+			int format = timer_format(arg);
+			uint64_t p, t, total = 0;
+			if (format && arg->j)
+				printf(format == TIMER_MACHINE ? "threads=%i\n" : "threads: %i\n", threads);
+			profile_reset();
+			/* every depth up to the requested one is timed */
+			for (int d = format ? MIN(1, depth) : depth; d <= depth; d++) {
+				t = time_ns();
+				p = perft_threads(pos, d, threads, arg->h, d == depth, d == depth && arg->v);
+				t = time_ns() - t;
+				total += t;
+				if (format)
+					timer_print(format, "perft", d, p, t);
+			}
+			if (format)
+				profile_print(format, total * threads);
 		}
 		else {
 			return 3;
@@ -146,10 +188,161 @@ int interface_perft(struct arg *arg) {
 	return 0;
 }
 
+int interface_perftsplit(struct arg *arg) {
+	UNUSED(arg);
+	if (arg->argc < 4)
+		return 2;
+	if (!string_is_int(arg->argv[1]) || !string_is_int(arg->argv[2]))
+		return 3;
+	int depth = atoi(arg->argv[1]);
+	int split = atoi(arg->argv[2]);
+	if (split < 1 || split >= depth)
+		return 3;
+	perft_split(pos, depth, split, arg->argv[3]);
+	return 0;
+}
+
+int interface_perftrun(struct arg *arg) {
+	UNUSED(arg);
+	int worker = 0, workers = 1;
+	if (arg->argc < 3 || arg->argc == 4)
+		return 2;
+	if (arg->argc >= 5) {
+		if (!string_is_int(arg->argv[3]) || !string_is_int(arg->argv[4]))
+			return 3;
+		worker = atoi(arg->argv[3]);
+		workers = atoi(arg->argv[4]);
+		if (workers < 1 || worker >= workers)
+			return 3;
+	}
+	int threads = arg->j ? sysconf(_SC_NPROCESSORS_ONLN) : 1;
+	double t = wall_time();
+	perft_run(arg->argv[1], arg->argv[2], worker, workers, threads, arg->h, arg->v);
+	t = wall_time() - t;
+	if (arg->t)
+		printf("time: %.2f\n", t);
+	return 0;
+}
+
+int interface_perftmerge(struct arg *arg) {
+	UNUSED(arg);
+	if (arg->argc < 3)
+		return 2;
+	perft_merge(arg->argv[1], arg->argc - 2, arg->argv + 2);
+	return 0;
+}
+
+int interface_perftsuite(struct arg *arg) {
+	UNUSED(arg);
+	int depth = 0;
+	if (arg->argc < 2)
+		return 2;
+	if (arg->argc >= 3) {
+		if (!string_is_int(arg->argv[2]))
+			return 3;
+		depth = atoi(arg->argv[2]);
+	}
+	int threads = 1;
+	if (arg->j) {
+		if (arg->argc < 4)
+			threads = sysconf(_SC_NPROCESSORS_ONLN);
+		else if (string_is_int(arg->argv[3]) && atoi(arg->argv[3]) > 0)
+			threads = atoi(arg->argv[3]);
+		else
+			return 3;
+	}
+	perft_suite(arg->argv[1], depth, threads, arg->h, arg->v);
+	return 0;
+}
+
+int interface_legalcheck(struct arg *arg) {
+	int positions = 1000;
+	if (arg->argc >= 2) {
+		if (!string_is_int(arg->argv[1]) || atoi(arg->argv[1]) <= 0)
+			return 3;
+		positions = atoi(arg->argv[1]);
+	}
+	move_gen_check(positions);
+	return 0;
+}
+
+int interface_findmagics(struct arg *arg) {
+	UNUSED(arg);
+	magic_bitboard_find();
+	return 0;
+}
+
+static inline void memory_print(const char *name, uint64_t size, uint64_t *total) {
+	printf("%-24s %10" PRIu64 "B\n", name, size);
+	*total += size;
+}
+
+int interface_memory(struct arg *arg) {
+	UNUSED(arg);
+	uint64_t total = 0;
+	memory_print("knight_attacks_lookup", sizeof(knight_attacks_lookup), &total);
+	memory_print("king_attacks_lookup", sizeof(king_attacks_lookup), &total);
+	memory_print("between_lookup", sizeof(between_lookup), &total);
+	memory_print("line_lookup", sizeof(line_lookup), &total);
+	memory_print("castle_lookup", sizeof(castle_lookup), &total);
+	memory_print("eval_table", sizeof(eval_table), &total);
+	memory_print("killer_move", sizeof(killer_move), &total);
+	memory_print(table_cache_mapped() ? "sliding_attacks (mapped)" : "sliding_attacks_lookup",
+			SLIDING_ATTACKS_SIZE * sizeof(uint64_t), &total);
+	memory_print("bishop_magic", sizeof(bishop_magic), &total);
+	memory_print("rook_magic", sizeof(rook_magic), &total);
+#ifndef BMI2
+	memory_print("bishop_magic_number", sizeof(bishop_magic_number), &total);
+	memory_print("rook_magic_number", sizeof(rook_magic_number), &total);
+#endif
+	memory_print("zobrist_key", ZOBRIST_KEYS * sizeof(uint64_t), &total);
+	printf("%-24s %10" PRIu64 "B\n", "total tables", total);
+	printf("%-24s %10" PRIu64 "B\n", "hash table", hash_table_size() * sizeof(struct hash_bucket));
+	printf("hash table pages: %s\n", alloc_pages_string(hash_table->pages));
+	if (perft_table_size_bytes()) {
+		printf("%-24s %10" PRIu64 "B\n", "perft table", perft_table_size_bytes());
+		printf("perft table pages: %s\n", alloc_pages_string(perft_table_pages()));
+	}
+	else {
+		printf("perft table: not allocated\n");
+	}
+	printf("attack table pages: %s\n", table_cache_mapped() ? "mapped" : alloc_pages_string(sliding_attacks_pages));
+	int64_t kib = alloc_anon_huge_kib();
+	if (kib >= 0)
+		printf("anonymous huge pages: %" PRIi64 "KiB\n", kib);
+	return 0;
+}
+
+int interface_hash(struct arg *arg) {
+	UNUSED(arg);
+	if (arg->argc < 2) {
+		printf("hash table size: %" PRIu64 "B\n", hash_table_size() * sizeof(struct hash_bucket));
+		return 0;
+	}
+	uint64_t bytes = string_to_bytes(arg->argv[1]);
+	if (!bytes)
+		return 3;
+	/* the perft table takes the new size when it is next used */
+	if (!hash_table_resize(bytes))
+		perft_term();
+	return 0;
+}
+
+int interface_hashbench(struct arg *arg) {
+	uint64_t count = 10000000;
+	if (arg->argc >= 2) {
+		if (!string_is_int(arg->argv[1]) || !atoll(arg->argv[1]))
+			return 3;
+		count = atoll(arg->argv[1]);
+	}
+	hash_table_bench(count);
+	return 0;
+}
+
 int interface_setpos(struct arg *arg) {
 	UNUSED(arg);
 	if (arg->r) {
-		random_pos(pos, 32);
+		random_pos(pos, 32, &main_rand);
 		while (move_last)
 			move_previous();
 	}
@@ -208,25 +401,27 @@ int interface_eval(struct arg *arg) {
 	}
 	else {
 		if (string_is_int(arg->argv[1])) {
-			uint64_t s;
+			int16_t s;
+			int format = timer_format(arg);
 			move *m = malloc(sizeof(move));
-			clock_t t = clock();
+			profile_reset();
+			uint64_t t = time_ns();
 			if (arg->h)
-				s = evaluate_hash(pos, atoi(arg->argv[1]), m, arg->v);
+				s = evaluate_hash(pos, atoi(arg->argv[1]), m, arg->v, format);
 			else
-				s = evaluate(pos, atoi(arg->argv[1]), m, arg->v);
-			t = clock() - t;
+				s = evaluate(pos, atoi(arg->argv[1]), m, arg->v, format);
+			t = time_ns() - t;
 			/* arg->v already sent to evaluate */
 			if (!arg->v) {
 				printf("%.2f ", (double)s / 100);
 				print_move(m);
 				printf("\n");
 			}
-			if (arg->t)
-				printf("time: %.2f\n", (double)t / CLOCKS_PER_SEC);
+			if (format)
+				profile_print(format, t);
 			if (arg->m && *m) {
 				move_next(*m);
-				do_move_zobrist(pos, move_last->move);
+				do_move_zobrist(pos, move_last->move, &move_last->undo);
 			}
 			free(m);
 		}
@@ -246,23 +441,41 @@ int interface_version(struct arg *arg) {
 	char t[8];
 	printf("compilation date: %s\n", date(t));
 	printf("hash table size: %" PRIu64 "B\n", (hash_table_size_bytes()
-							/ sizeof(struct hash_entry))
-			 				* sizeof(struct hash_entry));
-	printf("hash entry size: %" PRIu64 "B\n", sizeof(struct hash_entry));
+							/ sizeof(struct hash_bucket))
+			 				* sizeof(struct hash_bucket));
+	printf("hash entry size: %" PRIu64 "B, %i per bucket\n", sizeof(uint64_t) + sizeof(uint16_t), HASH_BUCKET_ENTRIES);
+	char features[64];
+	printf("cpu features: %s\n", cpu_string(features));
+	printf("move generation kernel: %s\n", move_gen_kernel_name());
+	printf("sliding attacks: %s\n", move_gen_pext() ? "pext" : "magic");
+	printf("popcount: %s\n", move_gen_popcnt() ? "hardware" : "software");
+	printf("lookup tables: %s\n", table_cache_mapped() ? "mapped" : "private");
+	/* not allocated yet with --version */
+	if (hash_table)
+		printf("hash table pages: %s\n", alloc_pages_string(hash_table->pages));
 
 	return 0;
 }
 
 struct func func_arr[] = {
-	{ "help",    interface_help,    },
-	{ "domove",  interface_domove,  },
-	{ "perft",   interface_perft,   },
-	{ "setpos",  interface_setpos,  },
-	{ "clear",   interface_clear,   },
-	{ "exit",    interface_exit,    },
-	{ "print",   interface_print,   },
-	{ "eval",    interface_eval,    },
-	{ "version", interface_version, },
+	{ "help",       interface_help,       },
+	{ "domove",     interface_domove,     },
+	{ "perft",      interface_perft,      },
+	{ "perftsplit", interface_perftsplit, },
+	{ "perftrun",   interface_perftrun,   },
+	{ "perftmerge", interface_perftmerge, },
+	{ "perftsuite", interface_perftsuite, },
+	{ "findmagics", interface_findmagics, },
+	{ "legalcheck", interface_legalcheck, },
+	{ "memory",     interface_memory,     },
+	{ "hash",       interface_hash,       },
+	{ "hashbench",  interface_hashbench,  },
+	{ "setpos",     interface_setpos,     },
+	{ "clear",      interface_clear,      },
+	{ "exit",       interface_exit,       },
+	{ "print",      interface_print,      },
+	{ "eval",       interface_eval,       },
+	{ "version",    interface_version,    },
 };
 
 int parse(int *argc, char ***argv) {
@@ -315,6 +528,12 @@ int parse(int *argc, char ***argv) {
 					case 'h':
 						arg->h = 1;
 						break;
+					case 'j':
+						arg->j = 1;
+						break;
+					case 'p':
+						arg->p = 1;
+						break;
 					}
 				}
 				j++;
@@ -390,6 +609,12 @@ int parse(int *argc, char ***argv) {
 						case 'h':
 							arg->h = 1;
 							break;
+						case 'j':
+							arg->j = 1;
+							break;
+						case 'p':
+							arg->p = 1;
+							break;
 					}
 				}
 			}
@@ -19,23 +19,63 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <inttypes.h>
 
 #include "bitboard.h"
 #include "util.h"
 #include "position.h"
 #include "init.h"
+#include "move_gen.h"
+#include "table_cache.h"
+#include "alloc.h"
+
+uint64_t *sliding_attacks_lookup = NULL;
+int sliding_attacks_pages = PAGES_NORMAL;
+
+struct magic bishop_magic[64] CACHE_ALIGN;
+struct magic rook_magic[64] CACHE_ALIGN;
+
+#ifndef BMI2
+/* generated and verified by findmagics */
+const uint64_t bishop_magic_number[64] = {
+	0x01B0493041020020, 0x0003302401104000, 0x802408028B008428, 0x001405060A401000,
+	0x2011104000004402, 0x2002011009802400, 0x0001008804400050, 0x1020402804022080,
+	0x2808908208080084, 0x10802031C1010300, 0x800004080A004808, 0xA05104404080A280,
+	0x000004042001A004, 0x0103808804400008, 0x0408111090100801, 0x0400A10100B00400,
+	0x01201828281050C4, 0x0002003410041300, 0x80040008840402A8, 0x0000800802044000,
+	0x1402000C22010830, 0x0008200100884002, 0xA001000404C21098, 0x0000200204844C00,
+	0x0085400044488802, 0x0002030010100228, 0x200C011030004080, 0x2828080002820122,
+	0x28C1001113004000, 0x00040100A020A000, 0x0014008001080130, 0x000280A00C9C0400,
+	0x50101004000A0802, 0x000110820210441A, 0x0804040413020021, 0x2080020080680080,
+	0x1001010400820020, 0x8012008100060042, 0x08102C0040010901, 0x0C01410028A10402,
+	0x0006901050000892, 0x2201180110800400, 0x8401001092081000, 0x01009E0216000401,
+	0x0040012011000200, 0x111020108E884100, 0x00108C0810802440, 0x0388191400800222,
+	0x00208A1120201008, 0x0A48804402200084, 0x0040230108260010, 0x0024008042020104,
+	0x0000084008220030, 0x0204150810030400, 0x0020200181110604, 0x0C28020800491084,
+	0x0005005050041003, 0x4000850C4804240C, 0x48003A0202013100, 0x8045000005086801,
+	0x00018004A0024408, 0x4011000A10112200, 0x00009270062A8C00, 0x8884200401002100,
+};
+
+const uint64_t rook_magic_number[64] = {
+	0x2080002040001080, 0x0440042000900240, 0x0200082016008040, 0x0100100004200901,
+	0x0A00020020050810, 0x0200010882004410, 0x0C80190002000080, 0x2080004830800100,
+	0x0001800080400230, 0x8010400050002000, 0x0008802000801000, 0x0301002009001000,
+	0x2041001100080004, 0x2802800400800200, 0x030E000441A20008, 0x0002000041008204,
+	0x0000808000400022, 0x0450004020004010, 0x0850008010802000, 0x0C00808010000804,
+	0x0001010004100800, 0x400C004002004100, 0x0000040048813002, 0x004C020004204081,
+	0x4003C00080106080, 0x2000400080200088, 0x2840104300200302, 0x0310028280080011,
+	0x0000050100100800, 0x1001000900440002, 0x5102002200280441, 0x0800488E00104104,
+	0x0440204000800080, 0x1210002002400040, 0x0800801008802002, 0x0002081001002300,
+	0x0208080080800400, 0x8300020080800400, 0x8001000401000200, 0x0010008042000104,
+	0x1000800040008020, 0x0800201000444004, 0x1010008020048011, 0x78041001008B0020,
+	0x0024008028018004, 0x0002000400028080, 0x1102000481020008, 0x80000255018A0004,
+	0x0001008001645500, 0x0940201000400140, 0x0208200108401100, 0x0082100024090100,
+	0x0400040080080080, 0x0C03000400020900, 0x0400810228500400, 0x0300091408408200,
+	0x0000800020104109, 0x1020108100284001, 0x00040A0080221042, 0x0040601429011001,
+	0x501B000208001005, 0x0101000208040001, 0x0050424090010804, 0x0000004404210086,
+};
+#endif
 
-uint64_t bishop_attacks_lookup[64 * 512];
-uint64_t rook_attacks_lookup[64 * 4096];
-
-uint64_t bishop_magic[64];
-uint64_t rook_magic[64];
-
-uint64_t bishop_mask[64];
-uint64_t rook_mask[64];
-
-uint64_t bishop_full_mask[64];
-uint64_t rook_full_mask[64];
 
 uint64_t bishop_attacks_calc(int square, uint64_t b) {
 	uint64_t attacks = 0;
@@ -157,54 +197,6 @@ uint64_t rook_mask_calc(int square) {
 	return mask;
 }
 
-uint64_t bishop_full_mask_calc(int square) {
-	uint64_t mask = 0;
-	int x = square % 8;
-	int y = square / 8;
-
-	for (int i = x + 1, j = y + 1; i < 8 && j < 8; i++, j++) {
-		mask |= bitboard(i + j * 8);
-	}
-
-	for (int i = x - 1, j = y + 1; -1 < i && j < 8; i--, j++) {
-		mask |= bitboard(i + j * 8);
-	}
-
-	for (int i = x + 1, j = y - 1; i < 8 && -1 < j; i++, j--) {
-		mask |= bitboard(i + j * 8);
-	}
-
-	for (int i = x - 1, j = y - 1; -1 < i && -1 < j; i--, j--) {
-		mask |= bitboard(i + j * 8);
-	}
-
-	return mask;
-}
-
-uint64_t rook_full_mask_calc(int square) {
-	uint64_t mask = 0;
-	int x = square % 8;
-	int y = square / 8;
-
-	for (int i = x + 1; i < 8; i++) {
-		mask |= bitboard(i + 8 * y);
-	}
-
-	for (int i = x - 1; i > -1; i--) {
-		mask |= bitboard(i + 8 * y);
-	}
-
-	for (int i = y + 1; i < 8; i++) {
-		mask |= bitboard(x + 8 * i);
-	}
-
-	for (int i = y - 1; i > -1; i--) {
-		mask |= bitboard(x + 8 * i);
-	}
-
-	return mask;
-}
-
 uint64_t block_mask(int i, uint64_t attack_mask) {
 	uint64_t occ = 0;
 	int j = 0;
@@ -220,27 +212,28 @@ uint64_t block_mask(int i, uint64_t attack_mask) {
 	return occ;
 }
 
-uint64_t bishop_magic_calc(int square) {
+uint64_t bishop_magic_calc(int square, struct rand_state *state) {
 	int i, j, k, flag;
 	uint64_t occ[512];
 	uint64_t attacks[512];
 	uint64_t used_attacks[512];
 	uint64_t attack_mask = bishop_mask_calc(square);
+	int bits = popcount(attack_mask);
 
-	for (i = 0; i < 512; i++) {
+	for (i = 0; i < (1 << bits); i++) {
 		occ[i] = block_mask(i, attack_mask);
 		attacks[i] = bishop_attacks_calc(square, occ[i]);
 	}
 
 	for (i = 0; i < 100000000; i++) {
-		uint64_t magic_number = rand_uint64() & rand_uint64() & rand_uint64();
+		uint64_t magic_number = rand_next(state) & rand_next(state) & rand_next(state);
 		if (popcount((attack_mask * magic_number) & 0xFF00000000000000) < 6)
 			continue;
 
 		memset(used_attacks, 0, sizeof(used_attacks));
 		
-		for (j = 0, flag = 0; !flag && j < 512; j++) {
-			k = (occ[j] * magic_number) >> (64 - 9);
+		for (j = 0, flag = 0; !flag && j < (1 << bits); j++) {
+			k = (occ[j] * magic_number) >> (64 - bits);
 
 			if (!used_attacks[k])
 				used_attacks[k] = attacks[j];
@@ -255,27 +248,28 @@ uint64_t bishop_magic_calc(int square) {
 	return 0;
 }
 
-uint64_t rook_magic_calc(int square) {
+uint64_t rook_magic_calc(int square, struct rand_state *state) {
 	int i, j, k, flag;
 	uint64_t occ[4096];
 	uint64_t attacks[4096];
 	uint64_t used_attacks[4096];
 	uint64_t attack_mask = rook_mask_calc(square);
+	int bits = popcount(attack_mask);
 
-	for (i = 0; i < 4096; i++) {
+	for (i = 0; i < (1 << bits); i++) {
 		occ[i] = block_mask(i, attack_mask);
 		attacks[i] = rook_attacks_calc(square, occ[i]);
 	}
 
 	for (i = 0; i < 100000000; i++) {
-		uint64_t magic_number = rand_uint64() & rand_uint64() & rand_uint64();
+		uint64_t magic_number = rand_next(state) & rand_next(state) & rand_next(state);
 		if (popcount((attack_mask * magic_number) & 0xFF00000000000000) < 6)
 			continue;
 
 		memset(used_attacks, 0, sizeof(used_attacks));
 		
-		for (j = 0, flag = 0; !flag && j < 4096; j++) {
-			k = (occ[j] * magic_number) >> (64 - 12);
+		for (j = 0, flag = 0; !flag && j < (1 << bits); j++) {
+			k = (occ[j] * magic_number) >> (64 - bits);
 
 			if (!used_attacks[k])
 				used_attacks[k] = attacks[j];
@@ -290,47 +284,152 @@ uint64_t rook_magic_calc(int square) {
 	return 0;
 }
 
-int magic_bitboard_init() {
-	int square, i;
-	uint64_t b;
+/* checks that no two occupancies with different attacks collide */
+int magic_verify(int square, uint64_t magic, int is_bishop) {
+	static uint64_t used_attacks[4096];
+	uint64_t attack_mask = is_bishop ? bishop_mask_calc(square) : rook_mask_calc(square);
+	int bits = popcount(attack_mask);
+	uint64_t occ, attacks;
+	int i, k;
+
+	memset(used_attacks, 0, sizeof(used_attacks));
+	for (i = 0; i < (1 << bits); i++) {
+		occ = block_mask(i, attack_mask);
+		attacks = is_bishop ? bishop_attacks_calc(square, occ) : rook_attacks_calc(square, occ);
+		k = (occ * magic) >> (64 - bits);
+
+		if (!used_attacks[k])
+			used_attacks[k] = attacks;
+		else if (used_attacks[k] != attacks)
+			return 0;
+	}
+	return 1;
+}
+
+void magic_print(char *name, uint64_t *magic) {
+	printf("const uint64_t %s[64] = {\n", name);
+	for (int square = 0; square < 64; square++)
+		printf("%s0x%016" PRIX64 ",%s", square % 4 ? " " : "\t", magic[square], square % 4 == 3 ? "\n" : "");
+	printf("};\n");
+}
+
+/* searches new magics for every square, verifies them and prints them
+ * in the format of the embedded tables. The embedded tables are
+ * verified first.
+ */
+int magic_bitboard_find() {
+	uint64_t bishop_new[64];
+	uint64_t rook_new[64];
+	int square, bad = 0;
 	char str[3];
+	/* the same magics every run */
+	struct rand_state state;
+	rand_seed(&state, 0);
 
+#ifndef BMI2
 	for (square = 0; square < 64; square++) {
-		bishop_magic[square] = bishop_magic_calc(square);
-		if (!bishop_magic[square]) {
-			printf("fatal error: no bishop magic found for %s\n", algebraic(str, square));
-			return 1;
+		if (!magic_verify(square, bishop_magic_number[square], 1)) {
+			printf("error: embedded bishop magic for %s is bad\n", algebraic(str, square));
+			bad = 1;
+		}
+		if (!magic_verify(square, rook_magic_number[square], 0)) {
+			printf("error: embedded rook magic for %s is bad\n", algebraic(str, square));
+			bad = 1;
 		}
-		init_status("generating bishop magics");
 	}
+	printf("embedded magics: %s\n", bad ? "bad" : "ok");
+#endif
+
 	for (square = 0; square < 64; square++) {
-		rook_magic[square] = rook_magic_calc(square);
-		if (!rook_magic[square]) {
-			printf("fatal error: no rook magic found for %s\n", algebraic(str, square));
+		bishop_new[square] = bishop_magic_calc(square, &state);
+		rook_new[square] = rook_magic_calc(square, &state);
+		if (!bishop_new[square] || !rook_new[square] ||
+				!magic_verify(square, bishop_new[square], 1) ||
+				!magic_verify(square, rook_new[square], 0)) {
+			printf("error: no magic found for %s\n", algebraic(str, square));
 			return 1;
 		}
-		init_status("generating rook magics");
 	}
-	for (i = 0; i < 64; i++) {
-		bishop_mask[i] = bishop_mask_calc(i);
-		rook_mask[i] = rook_mask_calc(i);
-		bishop_full_mask[i] = bishop_full_mask_calc(i);
-		rook_full_mask[i] = rook_full_mask_calc(i);
+	magic_print("bishop_magic_number", bishop_new);
+	printf("\n");
+	magic_print("rook_magic_number", rook_new);
+	return bad;
+}
+
+/* fills the square's range of sliding_attacks_lookup, returns 1 if two
+ * occupancies with different attacks collide.
+ */
+int magic_fill(struct magic *m, int square, int is_bishop, int pext) {
+	uint64_t b, attacks, *entry;
+	int bits = 64 - m->shift;
+
+	for (int i = 0; i < (1 << bits); i++) {
+		b = block_mask(i, m->mask);
+		attacks = is_bishop ? bishop_attacks_calc(square, b) : rook_attacks_calc(square, b);
+		/* block_mask deposits the bits of i in the mask, so pext gives back i */
+		entry = m->attacks + (pext ? (uint64_t)i : ((b * m->magic) >> m->shift));
+		if (*entry && *entry != attacks)
+			return 1;
+		*entry = attacks;
+		init_status(is_bishop ? "populating bishop attack table" : "populating rook attack table");
+	}
+	return 0;
+}
+
+int magic_bitboard_init() {
+	int square;
+	/* the mapped table file is read only, it is never written to */
+	uint64_t *cached = (uint64_t *)table_cache_attacks();
+	if (!cached) {
+		sliding_attacks_lookup = alloc_large(SLIDING_ATTACKS_SIZE * sizeof(uint64_t), &sliding_attacks_pages);
+		if (!sliding_attacks_lookup) {
+			printf("fatal error: could not allocate the attack tables\n");
+			return 1;
+		}
+	}
+	uint64_t *attacks = cached ? cached : sliding_attacks_lookup;
+	/* the table is laid out for the selected move generation kernel */
+	int pext = move_gen_pext();
+	char str[3];
+
+	for (square = 0; square < 64; square++) {
+		bishop_magic[square].mask = bishop_mask_calc(square);
+		rook_magic[square].mask = rook_mask_calc(square);
+#ifndef BMI2
+		bishop_magic[square].magic = bishop_magic_number[square];
+		rook_magic[square].magic = rook_magic_number[square];
+#endif
+		bishop_magic[square].shift = 64 - popcount(bishop_magic[square].mask);
+		rook_magic[square].shift = 64 - popcount(rook_magic[square].mask);
 		init_status("generating attack masks");
 	}
+	/* the squares are packed back to back, bishops first */
+	for (square = 0; square < 64; square++) {
+		bishop_magic[square].attacks = attacks;
+		attacks += (uint64_t)1 << (64 - bishop_magic[square].shift);
+	}
+	for (square = 0; square < 64; square++) {
+		rook_magic[square].attacks = attacks;
+		attacks += (uint64_t)1 << (64 - rook_magic[square].shift);
+	}
+	if (cached)
+		return 0;
 	for (square = 0; square < 64; square++) {
-		for (i = 0; i < 512; i++) {
-			b = block_mask(i, bishop_mask[square]);
-			bishop_attacks_lookup[bishop_index(square, b)] = bishop_attacks_calc(square, b);
-			init_status("populating bishop attack table");
+		if (magic_fill(&bishop_magic[square], square, 1, pext)) {
+			printf("fatal error: bad bishop magic for %s\n", algebraic(str, square));
+			return 1;
 		}
 	}
 	for (square = 0; square < 64; square++) {
-		for (i = 0; i < 4096; i++) {
-			b = block_mask(i, rook_mask[square]);
-			rook_attacks_lookup[rook_index(square, b)] = rook_attacks_calc(square, b);
-			init_status("populating rook attack table");
+		if (magic_fill(&rook_magic[square], square, 0, pext)) {
+			printf("fatal error: bad rook magic for %s\n", algebraic(str, square));
+			return 1;
 		}
 	}
 	return 0;
 }
+
+void magic_bitboard_term() {
+	free_large(sliding_attacks_lookup, SLIDING_ATTACKS_SIZE * sizeof(uint64_t));
+	sliding_attacks_lookup = NULL;
+}
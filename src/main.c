@@ -17,31 +17,36 @@
 
 #include "init.h"
 #include "util.h"
-#include "bitboard.h"
 #include "magic_bitboard.h"
-#include "attack_gen.h"
-#include "evaluate.h"
 #include "hash_table.h"
+#include "perft.h"
 #include "interface.h"
+#include "cpu.h"
+#include "move_gen.h"
+#include "table_cache.h"
 
 int main(int argc, char **argv) {
+	cpu_init();
+	move_gen_init();
 	/* --version */
-	if (init(argc, argv))
+	if (init(&argc, &argv))
 		goto term;
 	util_init();
+	table_cache_init();
 	/* no magic found */
 	if (magic_bitboard_init())
 		goto term;
-	attack_gen_init();
-	bitboard_init();
-	evaluate_init();
 	/* hash table size == 0 */
 	if (hash_table_init())
 		goto term;
+	table_cache_store();
 	interface_init();
 	interface(argc, argv);
 term:;
 	interface_term();
+	perft_term();
 	hash_table_term();
+	magic_bitboard_term();
+	table_cache_term();
 	term();
 }
@@ -27,7 +27,18 @@
 #include "move_gen.h"
 #include "hash_table.h"
 
-void do_move(struct position *pos, move *m) {
+/* us is the side to move, 1 for white and 0 for black. The zobrist key,
+ * halfmove and fullmove clocks are only updated if zobrist is set. Both
+ * are resolved at compile time since the function is always inlined.
+ */
+static ALWAYS_INLINE void do_move_generic(struct position *pos, move *m, struct undo *u, const int us, const int zobrist) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	const int own_offset = us ? 0 : 6;
+	const int enemy_offset = us ? 6 : 0;
+	const int up = us ? 8 : -8;
+	const int back = us ? 0 : 56;
+
 	uint8_t source_square = move_from(m);
 	uint8_t target_square = move_to(m);
 
@@ -35,211 +46,129 @@ void do_move(struct position *pos, move *m) {
 	uint64_t to = bitboard(target_square);
 	uint64_t from_to = from | to;
 
-	move_set_castle(m, pos->castle);
-	move_set_en_passant(m, pos->en_passant);
+	if (zobrist) {
+		u->zobrist_key = pos->zobrist_key;
+		u->halfmove = pos->halfmove;
+		if (pos->mailbox[target_square] || pos->mailbox[source_square] == pawn + own_offset)
+			pos->halfmove = 0;
+		else
+			pos->halfmove++;
+		if (!us)
+			pos->fullmove++;
+
+		if (pos->en_passant)
+			pos->zobrist_key ^= zobrist_en_passant_key(pos->en_passant);
+		pos->zobrist_key ^= zobrist_castle_key(pos->castle);
+	}
+
+	u->castle = pos->castle;
+	u->en_passant = pos->en_passant;
+	u->captured = 0;
 
 	pos->en_passant = 0;
 
 	pos->castle = castle(source_square, target_square, pos->castle);
 
-	if (pos->turn) {
-		if (pos->mailbox[target_square]) {
-			pos->black_pieces[pos->mailbox[target_square] - 6] ^= to;
-			move_set_captured(m, pos->mailbox[target_square] - 6);
-			pos->black_pieces[all] ^= to;
-		}
-
-		if (pos->mailbox[source_square] == white_pawn) {
-			pos->mailbox[target_square] = white_pawn;
-			if (source_square + 16 == target_square) {
-				pos->en_passant = target_square - 8;
-			}
-			else if (move_flag(m) == 1) {
-				pos->black_pieces[pawn] ^= bitboard(target_square - 8);
-				pos->black_pieces[all] ^= bitboard(target_square - 8);
-				pos->mailbox[target_square - 8] = empty;
-
-			}
-			else if (move_flag(m) == 2) {
-				pos->white_pieces[pawn] ^= to;
-				pos->white_pieces[move_promote(m) + 2] ^= to;
-				pos->mailbox[target_square] = move_promote(m) + 2;
-			}
-			pos->white_pieces[pawn] ^= from_to;
-		}
-		else if (pos->mailbox[source_square] == white_king) {
-			pos->white_pieces[king] ^= from_to;
-			if (move_flag(m) == 3) {
-				if (target_square == 6) {
-					pos->white_pieces[rook] ^= 0xA0;
-					pos->white_pieces[all] ^= 0xA0;
-					pos->mailbox[h1] = empty;
-					pos->mailbox[f1] = white_rook;
-				}
-				else if (target_square == 2) {
-					pos->white_pieces[rook] ^= 0x9;
-					pos->white_pieces[all] ^= 0x9;
-					pos->mailbox[a1] = empty;
-					pos->mailbox[d1] = white_rook;
-				}
-			}
-			pos->mailbox[target_square] = white_king;
-		}
-		else {
-			pos->white_pieces[pos->mailbox[source_square]] ^= from_to;
-			pos->mailbox[target_square] = pos->mailbox[source_square];
-		}
-
-		pos->white_pieces[all] ^= from_to;
-		pos->mailbox[source_square] = empty;
+	if (pos->mailbox[target_square]) {
+		enemy[pos->mailbox[target_square] - enemy_offset] ^= to;
+		u->captured = pos->mailbox[target_square] - enemy_offset;
+		enemy[all] ^= to;
+		if (zobrist)
+			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
 	}
-	else {
-		if (pos->mailbox[target_square]) {
-			pos->white_pieces[pos->mailbox[target_square]] ^= to;
-			move_set_captured(m, pos->mailbox[target_square]);
-			pos->white_pieces[all] ^= to;
-		}
 
-		if (pos->mailbox[source_square] == black_pawn) {
-			pos->mailbox[target_square] = black_pawn;
-			if (source_square - 16 == target_square) {
-				pos->en_passant = target_square + 8;
-			}
-			else if (move_flag(m) == 1) {
-				pos->white_pieces[pawn] ^= bitboard(target_square + 8);
-				pos->white_pieces[all] ^= bitboard(target_square + 8);
-				pos->mailbox[target_square + 8] = 0;
-			}
-			else if (move_flag(m) == 2) {
-				pos->black_pieces[pawn] ^= to;
-				pos->black_pieces[move_promote(m) + 2] ^= to;
-				pos->mailbox[target_square] = move_promote(m) + 8;
+	if (pos->mailbox[source_square] == pawn + own_offset) {
+		pos->mailbox[target_square] = pawn + own_offset;
+		if (source_square + 2 * up == target_square) {
+			/* only set if it can be captured, or transpositions would differ in key */
+			if ((shift_west(to) | shift_east(to)) & enemy[pawn]) {
+				pos->en_passant = target_square - up;
+				if (zobrist)
+					pos->zobrist_key ^= zobrist_en_passant_key(target_square - up);
 			}
-			pos->black_pieces[pawn] ^= from_to;
 		}
-		else if (pos->mailbox[source_square] == black_king) {
-			pos->black_pieces[king] ^= from_to;
-			if (move_flag(m) == 3) {
-				if (target_square == 62) {
-					pos->black_pieces[rook] ^= 0xA000000000000000;
-					pos->black_pieces[all] ^= 0xA000000000000000;
-					pos->mailbox[h8] = empty;
-					pos->mailbox[f8] = black_rook;
-				}
-				else if (target_square == 58) {
-					pos->black_pieces[rook] ^= 0x900000000000000;
-					pos->black_pieces[all] ^= 0x900000000000000;
-					pos->mailbox[a8] = empty;
-					pos->mailbox[d8] = black_rook;
-				}
+		else if (move_flag(m) == 1) {
+			enemy[pawn] ^= bitboard(target_square - up);
+			enemy[all] ^= bitboard(target_square - up);
+			pos->mailbox[target_square - up] = empty;
+			if (zobrist)
+				pos->zobrist_key ^= zobrist_piece_key(pawn + enemy_offset - 1, target_square - up);
+		}
+		else if (move_flag(m) == 2) {
+			own[pawn] ^= to;
+			own[move_promote(m) + 2] ^= to;
+			pos->mailbox[target_square] = move_promote(m) + 2 + own_offset;
+			if (zobrist) {
+				pos->zobrist_key ^= zobrist_piece_key(pawn + own_offset - 1, target_square);
+				pos->zobrist_key ^= zobrist_piece_key(move_promote(m) + 1 + own_offset, target_square);
 			}
-			pos->mailbox[target_square] = black_king;
 		}
-		else {
-			pos->black_pieces[pos->mailbox[source_square] - 6] ^= from_to;
-			pos->mailbox[target_square] = pos->mailbox[source_square];
+		own[pawn] ^= from_to;
+		if (zobrist) {
+			pos->zobrist_key ^= zobrist_piece_key(pawn + own_offset - 1, source_square);
+			pos->zobrist_key ^= zobrist_piece_key(pawn + own_offset - 1, target_square);
 		}
-
-		pos->black_pieces[all] ^= from_to;
-		pos->mailbox[source_square] = empty;
 	}
-	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
-
-	pos->turn = 1 - pos->turn;
-}
-
-void undo_move(struct position *pos, move *m) {
-	uint8_t source_square = move_from(m);
-	uint8_t target_square = move_to(m);
-
-	uint64_t from = bitboard(source_square);
-	uint64_t to = bitboard(target_square);
-	uint64_t from_to = from | to;
-
-	pos->castle = move_castle(m);
-
-	pos->en_passant = move_en_passant(m);
-
-	if (pos->turn) {
-		pos->black_pieces[pos->mailbox[target_square] - 6] ^= from_to;
-		if (move_flag(m) == 1) {
-			pos->white_pieces[pawn] |= bitboard(target_square + 8);
-			pos->white_pieces[all] |= pos->white_pieces[pawn];
-			pos->mailbox[target_square + 8] = white_pawn;
-		}
-		else if (move_flag(m) == 2) {
-			pos->black_pieces[pawn] ^= from;
-			pos->black_pieces[pos->mailbox[target_square] - 6] ^= from;
-			pos->mailbox[target_square] = black_pawn;
-		}
-		else if (move_flag(m) == 3) {
-			if (target_square == 62) {
-				pos->black_pieces[rook] ^= 0xA000000000000000;
-				pos->black_pieces[all] ^= 0xA000000000000000;
-				pos->mailbox[h8] = black_rook;
-				pos->mailbox[f8] = empty;
+	else if (pos->mailbox[source_square] == king + own_offset) {
+		own[king] ^= from_to;
+		if (move_flag(m) == 3) {
+			if (target_square == g1 + back) {
+				own[rook] ^= (uint64_t)0xA0 << back;
+				own[all] ^= (uint64_t)0xA0 << back;
+				pos->mailbox[h1 + back] = empty;
+				pos->mailbox[f1 + back] = rook + own_offset;
+				if (zobrist) {
+					pos->zobrist_key ^= zobrist_piece_key(rook + own_offset - 1, h1 + back);
+					pos->zobrist_key ^= zobrist_piece_key(rook + own_offset - 1, f1 + back);
+				}
 			}
-			else if (target_square == 58) {
-				pos->black_pieces[rook] ^= 0x900000000000000;
-				pos->black_pieces[all] ^= 0x900000000000000;
-				pos->mailbox[a8] = black_rook;
-				pos->mailbox[d8] = empty;
+			else if (target_square == c1 + back) {
+				own[rook] ^= (uint64_t)0x9 << back;
+				own[all] ^= (uint64_t)0x9 << back;
+				pos->mailbox[a1 + back] = empty;
+				pos->mailbox[d1 + back] = rook + own_offset;
+				if (zobrist) {
+					pos->zobrist_key ^= zobrist_piece_key(rook + own_offset - 1, a1 + back);
+					pos->zobrist_key ^= zobrist_piece_key(rook + own_offset - 1, d1 + back);
+				}
 			}
 		}
-
-		pos->mailbox[source_square] = pos->mailbox[target_square];
-		pos->mailbox[target_square] = empty;
-
-		if (move_capture(m)) {
-			pos->white_pieces[move_capture(m)] ^= to;
-			pos->white_pieces[all] ^= to;
-			pos->mailbox[target_square] = move_capture(m);
+		pos->mailbox[target_square] = king + own_offset;
+		if (zobrist) {
+			pos->zobrist_key ^= zobrist_piece_key(king + own_offset - 1, source_square);
+			pos->zobrist_key ^= zobrist_piece_key(king + own_offset - 1, target_square);
 		}
-		pos->black_pieces[all] ^= from_to;
 	}
 	else {
-		pos->white_pieces[pos->mailbox[target_square]] ^= from_to;
-		if (move_flag(m) == 1) {
-			pos->black_pieces[pawn] |= bitboard(target_square - 8);
-			pos->black_pieces[all] |= pos->black_pieces[pawn];
-			pos->mailbox[target_square - 8] = black_pawn;
-		}
-		else if (move_flag(m) == 2) {
-			pos->white_pieces[pawn] ^= from;
-			pos->white_pieces[pos->mailbox[target_square]] ^= from;
-			pos->mailbox[target_square] = white_pawn;
-		}
-		else if (move_flag(m) == 3) {
-			if (target_square == 6) {
-				pos->white_pieces[rook] ^= 0xA0;
-				pos->white_pieces[all] ^= 0xA0;
-				pos->mailbox[h1] = white_rook;
-				pos->mailbox[f1] = empty;
-			}
-			else if (target_square == 2) {
-				pos->white_pieces[rook] ^= 0x9;
-				pos->white_pieces[all] ^= 0x9;
-				pos->mailbox[a1] = white_rook;
-				pos->mailbox[d1] = empty;
-			}
+		own[pos->mailbox[source_square] - own_offset] ^= from_to;
+		pos->mailbox[target_square] = pos->mailbox[source_square];
+		if (zobrist) {
+			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, source_square);
+			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
 		}
+	}
 
-		pos->mailbox[source_square] = pos->mailbox[target_square];
-		pos->mailbox[target_square] = empty;
+	own[all] ^= from_to;
+	pos->mailbox[source_square] = empty;
 
-		if (move_capture(m)) {
-			pos->black_pieces[move_capture(m)] ^= to;
-			pos->black_pieces[all] ^= to;
-			pos->mailbox[target_square] = move_capture(m) + 6;
-		}
-		pos->white_pieces[all] ^= from_to;
-	}
+	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
 
 	pos->turn = 1 - pos->turn;
-	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
+	if (zobrist) {
+		pos->zobrist_key ^= zobrist_turn_key();
+		pos->zobrist_key ^= zobrist_castle_key(pos->castle);
+	}
 }
 
-void do_move_zobrist(struct position *pos, move *m) {
+/* us is the side that made the move */
+static ALWAYS_INLINE void undo_move_generic(struct position *pos, move *m, struct undo *u, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	const int own_offset = us ? 0 : 6;
+	const int enemy_offset = us ? 6 : 0;
+	const int up = us ? 8 : -8;
+	const int back = us ? 0 : 56;
+
 	uint8_t source_square = move_from(m);
 	uint8_t target_square = move_to(m);
 
@@ -247,271 +176,83 @@ void do_move_zobrist(struct position *pos, move *m) {
 	uint64_t to = bitboard(target_square);
 	uint64_t from_to = from | to;
 
-	if (pos->en_passant)
-		pos->zobrist_key ^= zobrist_en_passant_key(pos->en_passant);
-	pos->zobrist_key ^= zobrist_castle_key(pos->castle);
-	move_set_castle(m, pos->castle);
-	move_set_en_passant(m, pos->en_passant);
-
-	pos->en_passant = 0;
-
-	pos->castle = castle(source_square, target_square, pos->castle);
+	pos->castle = u->castle;
 
-	if (pos->turn) {
-		if (pos->mailbox[target_square]) {
-			pos->black_pieces[pos->mailbox[target_square] - 6] ^= to;
-			move_set_captured(m, pos->mailbox[target_square] - 6);
-			pos->black_pieces[all] ^= to;
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		}
+	pos->en_passant = u->en_passant;
 
-		if (pos->mailbox[source_square] == white_pawn) {
-			pos->mailbox[target_square] = white_pawn;
-			if (source_square + 16 == target_square) {
-				pos->zobrist_key ^= zobrist_en_passant_key(target_square - 8);
-				pos->en_passant = target_square - 8;
-			}
-			else if (move_flag(m) == 1) {
-				pos->black_pieces[pawn] ^= bitboard(target_square - 8);
-				pos->black_pieces[all] ^= bitboard(target_square - 8);
-				pos->mailbox[target_square - 8] = empty;
-				pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, target_square - 8);
-
-			}
-			else if (move_flag(m) == 2) {
-				pos->white_pieces[pawn] ^= to;
-				pos->white_pieces[move_promote(m) + 2] ^= to;
-				pos->mailbox[target_square] = move_promote(m) + 2;
-				pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, target_square);
-				pos->zobrist_key ^= zobrist_piece_key(move_promote(m) + 1, target_square);
-			}
-			pos->white_pieces[pawn] ^= from_to;
-			pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, target_square);
-		}
-		else if (pos->mailbox[source_square] == white_king) {
-			pos->white_pieces[king] ^= from_to;
-			if (move_flag(m) == 3) {
-				if (target_square == 6) {
-					pos->white_pieces[rook] ^= 0xA0;
-					pos->white_pieces[all] ^= 0xA0;
-					pos->mailbox[h1] = empty;
-					pos->mailbox[f1] = white_rook;
-					pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, h1);
-					pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, f1);
-				}
-				else if (target_square == 2) {
-					pos->white_pieces[rook] ^= 0x9;
-					pos->white_pieces[all] ^= 0x9;
-					pos->mailbox[a1] = empty;
-					pos->mailbox[d1] = white_rook;
-					pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, a1);
-					pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, d1);
-				}
-			}
-			pos->mailbox[target_square] = white_king;
-			pos->zobrist_key ^= zobrist_piece_key(white_king - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(white_king - 1, target_square);
-		}
-		else {
-			pos->white_pieces[pos->mailbox[source_square]] ^= from_to;
-			pos->mailbox[target_square] = pos->mailbox[source_square];
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		}
-
-		pos->white_pieces[all] ^= from_to;
-		pos->mailbox[source_square] = empty;
+	own[pos->mailbox[target_square] - own_offset] ^= from_to;
+	if (move_flag(m) == 1) {
+		enemy[pawn] |= bitboard(target_square - up);
+		enemy[all] |= enemy[pawn];
+		pos->mailbox[target_square - up] = pawn + enemy_offset;
 	}
-	else {
-		pos->fullmove++;
-		if (pos->mailbox[target_square]) {
-			pos->white_pieces[pos->mailbox[target_square]] ^= to;
-			move_set_captured(m, pos->mailbox[target_square]);
-			pos->white_pieces[all] ^= to;
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
+	else if (move_flag(m) == 2) {
+		own[pawn] ^= from;
+		own[pos->mailbox[target_square] - own_offset] ^= from;
+		pos->mailbox[target_square] = pawn + own_offset;
+	}
+	else if (move_flag(m) == 3) {
+		if (target_square == g1 + back) {
+			own[rook] ^= (uint64_t)0xA0 << back;
+			own[all] ^= (uint64_t)0xA0 << back;
+			pos->mailbox[h1 + back] = rook + own_offset;
+			pos->mailbox[f1 + back] = empty;
+		}
+		else if (target_square == c1 + back) {
+			own[rook] ^= (uint64_t)0x9 << back;
+			own[all] ^= (uint64_t)0x9 << back;
+			pos->mailbox[a1 + back] = rook + own_offset;
+			pos->mailbox[d1 + back] = empty;
 		}
+	}
 
-		if (pos->mailbox[source_square] == black_pawn) {
-			pos->mailbox[target_square] = black_pawn;
-			if (source_square - 16 == target_square) {
-				pos->en_passant = target_square + 8;
-				pos->zobrist_key ^= zobrist_en_passant_key(target_square + 8);
-			}
-			else if (move_flag(m) == 1) {
-				pos->white_pieces[pawn] ^= bitboard(target_square + 8);
-				pos->white_pieces[all] ^= bitboard(target_square + 8);
-				pos->mailbox[target_square + 8] = 0;
-				pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, target_square + 8);
-			}
-			else if (move_flag(m) == 2) {
-				pos->black_pieces[pawn] ^= to;
-				pos->black_pieces[move_promote(m) + 2] ^= to;
-				pos->mailbox[target_square] = move_promote(m) + 8;
-				pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, target_square);
-				pos->zobrist_key ^= zobrist_piece_key(move_promote(m) + 7, target_square);
-			}
-			pos->black_pieces[pawn] ^= from_to;
-			pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, target_square);
-		}
-		else if (pos->mailbox[source_square] == black_king) {
-			pos->black_pieces[king] ^= from_to;
-			if (move_flag(m) == 3) {
-				if (target_square == 62) {
-					pos->black_pieces[rook] ^= 0xA000000000000000;
-					pos->black_pieces[all] ^= 0xA000000000000000;
-					pos->mailbox[h8] = empty;
-					pos->mailbox[f8] = black_rook;
-					pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, h8);
-					pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, f8);
-				}
-				else if (target_square == 58) {
-					pos->black_pieces[rook] ^= 0x900000000000000;
-					pos->black_pieces[all] ^= 0x900000000000000;
-					pos->mailbox[a8] = empty;
-					pos->mailbox[d8] = black_rook;
-					pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, a8);
-					pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, d8);
-				}
-			}
-			pos->mailbox[target_square] = black_king;
-			pos->zobrist_key ^= zobrist_piece_key(black_king - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(black_king - 1, target_square);
-		}
-		else {
-			pos->black_pieces[pos->mailbox[source_square] - 6] ^= from_to;
-			pos->mailbox[target_square] = pos->mailbox[source_square];
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, source_square);
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		}
+	pos->mailbox[source_square] = pos->mailbox[target_square];
+	pos->mailbox[target_square] = empty;
 
-		pos->black_pieces[all] ^= from_to;
-		pos->mailbox[source_square] = empty;
+	if (u->captured) {
+		enemy[u->captured] ^= to;
+		enemy[all] ^= to;
+		pos->mailbox[target_square] = u->captured + enemy_offset;
 	}
-	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
+	own[all] ^= from_to;
 
 	pos->turn = 1 - pos->turn;
-	pos->zobrist_key ^= zobrist_turn_key();
-	pos->zobrist_key ^= zobrist_castle_key(pos->castle);
+	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
 }
 
-void undo_move_zobrist(struct position *pos, move *m) {
-	uint8_t source_square = move_from(m);
-	uint8_t target_square = move_to(m);
+void do_move(struct position *pos, move *m, struct undo *u) {
+	if (pos->turn)
+		do_move_generic(pos, m, u, 1, 0);
+	else
+		do_move_generic(pos, m, u, 0, 0);
+}
 
-	uint64_t from = bitboard(source_square);
-	uint64_t to = bitboard(target_square);
-	uint64_t from_to = from | to;
+void undo_move(struct position *pos, move *m, struct undo *u) {
+	if (pos->turn)
+		undo_move_generic(pos, m, u, 0);
+	else
+		undo_move_generic(pos, m, u, 1);
+}
 
-	pos->zobrist_key ^= zobrist_castle_key(pos->castle);
-	pos->zobrist_key ^= zobrist_castle_key(move_castle(m));
-	pos->castle = move_castle(m);
+void do_move_zobrist(struct position *pos, move *m, struct undo *u) {
+	if (pos->turn)
+		do_move_generic(pos, m, u, 1, 1);
+	else
+		do_move_generic(pos, m, u, 0, 1);
+}
 
-	if (pos->en_passant)
-		pos->zobrist_key ^= zobrist_en_passant_key(pos->en_passant);
-	pos->en_passant = move_en_passant(m);
-	pos->zobrist_key ^= zobrist_en_passant_key(pos->en_passant);
+void do_move_prefetch(struct position *pos, move *m, struct undo *u) {
+	do_move_zobrist(pos, m, u);
+	hash_table_prefetch(pos->zobrist_key);
+}
 
-	if (pos->turn) {
+/* the key is restored from the undo record instead of being updated */
+void undo_move_zobrist(struct position *pos, move *m, struct undo *u) {
+	undo_move(pos, m, u);
+	if (!pos->turn)
 		pos->fullmove--;
-		pos->black_pieces[pos->mailbox[target_square] - 6] ^= from_to;
-		if (move_flag(m) == 1) {
-			pos->white_pieces[pawn] |= bitboard(target_square + 8);
-			pos->white_pieces[all] |= pos->white_pieces[pawn];
-			pos->mailbox[target_square + 8] = white_pawn;
-			pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, target_square + 8);
-		}
-		else if (move_flag(m) == 2) {
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-			pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, target_square);
-			pos->black_pieces[pawn] ^= from;
-			pos->black_pieces[pos->mailbox[target_square] - 6] ^= from;
-			pos->mailbox[target_square] = black_pawn;
-		}
-		else if (move_flag(m) == 3) {
-			if (target_square == 62) {
-				pos->black_pieces[rook] ^= 0xA000000000000000;
-				pos->black_pieces[all] ^= 0xA000000000000000;
-				pos->mailbox[h8] = black_rook;
-				pos->mailbox[f8] = empty;
-				pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, h8);
-				pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, f8);
-			}
-			else if (target_square == 58) {
-				pos->black_pieces[rook] ^= 0x900000000000000;
-				pos->black_pieces[all] ^= 0x900000000000000;
-				pos->mailbox[a8] = black_rook;
-				pos->mailbox[d8] = empty;
-				pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, a8);
-				pos->zobrist_key ^= zobrist_piece_key(black_rook - 1, d8);
-			}
-		}
-
-		pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, source_square);
-		pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		pos->mailbox[source_square] = pos->mailbox[target_square];
-		pos->mailbox[target_square] = empty;
-
-		if (move_capture(m)) {
-			pos->white_pieces[move_capture(m)] ^= to;
-			pos->white_pieces[all] ^= to;
-			pos->mailbox[target_square] = move_capture(m);
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		}
-		pos->black_pieces[all] ^= from_to;
-	}
-	else {
-		pos->white_pieces[pos->mailbox[target_square]] ^= from_to;
-		if (move_flag(m) == 1) {
-			pos->black_pieces[pawn] |= bitboard(target_square - 8);
-			pos->black_pieces[all] |= pos->black_pieces[pawn];
-			pos->mailbox[target_square - 8] = black_pawn;
-			pos->zobrist_key ^= zobrist_piece_key(black_pawn - 1, target_square - 8);
-		}
-		else if (move_flag(m) == 2) {
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-			pos->zobrist_key ^= zobrist_piece_key(white_pawn - 1, target_square);
-			pos->white_pieces[pawn] ^= from;
-			pos->white_pieces[pos->mailbox[target_square]] ^= from;
-			pos->mailbox[target_square] = white_pawn;
-		}
-		else if (move_flag(m) == 3) {
-			if (target_square == 6) {
-				pos->white_pieces[rook] ^= 0xA0;
-				pos->white_pieces[all] ^= 0xA0;
-				pos->mailbox[h1] = white_rook;
-				pos->mailbox[f1] = empty;
-				pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, h1);
-				pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, f1);
-			}
-			else if (target_square == 2) {
-				pos->white_pieces[rook] ^= 0x9;
-				pos->white_pieces[all] ^= 0x9;
-				pos->mailbox[a1] = white_rook;
-				pos->mailbox[d1] = empty;
-				pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, a1);
-				pos->zobrist_key ^= zobrist_piece_key(white_rook - 1, d1);
-			}
-		}
-
-		pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, source_square);
-		pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		pos->mailbox[source_square] = pos->mailbox[target_square];
-		pos->mailbox[target_square] = empty;
-
-		if (move_capture(m)) {
-			pos->black_pieces[move_capture(m)] ^= to;
-			pos->black_pieces[all] ^= to;
-			pos->mailbox[target_square] = move_capture(m) + 6;
-			pos->zobrist_key ^= zobrist_piece_key(pos->mailbox[target_square] - 1, target_square);
-		}
-		pos->white_pieces[all] ^= from_to;
-	}
-
-	pos->turn = 1 - pos->turn;
-	pos->pieces = pos->white_pieces[all] | pos->black_pieces[all];
-	pos->zobrist_key ^= zobrist_turn_key();
+	pos->halfmove = u->halfmove;
+	pos->zobrist_key = u->zobrist_key;
 }
 
 void print_move(move *m) {
@@ -17,899 +17,192 @@
 
 #include "move_gen.h"
 
+#include <stdio.h>
 #include <stdlib.h>
-
-#include "bitboard.h"
-#include "attack_gen.h"
-
-move *generate_all(struct position *pos, move *move_list) {
-	return pos->turn ? generate_white(pos, move_list) : generate_black(pos, move_list);
+#include <string.h>
+#include <inttypes.h>
+
+#include "move_gen_kernel.h"
+#include "cpu.h"
+#include "util.h"
+
+move *(*generate_white)(struct position *pos, move *move_list) = generate_white_generic;
+move *(*generate_black)(struct position *pos, move *move_list) = generate_black_generic;
+move *(*generate_captures_white)(struct position *pos, move *move_list) = generate_captures_white_generic;
+move *(*generate_captures_black)(struct position *pos, move *move_list) = generate_captures_black_generic;
+move *(*generate_quiets_white)(struct position *pos, move *move_list) = generate_quiets_white_generic;
+move *(*generate_quiets_black)(struct position *pos, move *move_list) = generate_quiets_black_generic;
+uint64_t (*count_white)(struct position *pos) = count_white_generic;
+uint64_t (*count_black)(struct position *pos) = count_black_generic;
+uint64_t (*generate_checkers_white)(struct position *pos) = generate_checkers_white_generic;
+uint64_t (*generate_checkers_black)(struct position *pos) = generate_checkers_black_generic;
+uint64_t (*generate_attacked_white)(struct position *pos) = generate_attacked_white_generic;
+uint64_t (*generate_attacked_black)(struct position *pos) = generate_attacked_black_generic;
+uint64_t (*generate_pinned_white)(struct position *pos) = generate_pinned_white_generic;
+uint64_t (*generate_pinned_black)(struct position *pos) = generate_pinned_black_generic;
+int (*move_is_legal)(struct position *pos, move m) = move_is_legal_generic;
+
+int move_gen_kernel = KERNEL_GENERIC;
+
+static const char *kernel_name[KERNELS] = { "generic", "popcnt", "bmi2" };
+
+#define KERNEL_SELECT(kernel) do {                                        \
+	generate_white = generate_white_##kernel;                         \
+	generate_black = generate_black_##kernel;                         \
+	generate_captures_white = generate_captures_white_##kernel;       \
+	generate_captures_black = generate_captures_black_##kernel;       \
+	generate_quiets_white = generate_quiets_white_##kernel;           \
+	generate_quiets_black = generate_quiets_black_##kernel;           \
+	count_white = count_white_##kernel;                               \
+	count_black = count_black_##kernel;                               \
+	generate_checkers_white = generate_checkers_white_##kernel;       \
+	generate_checkers_black = generate_checkers_black_##kernel;       \
+	generate_attacked_white = generate_attacked_white_##kernel;       \
+	generate_attacked_black = generate_attacked_black_##kernel;       \
+	generate_pinned_white = generate_pinned_white_##kernel;           \
+	generate_pinned_black = generate_pinned_black_##kernel;           \
+	move_is_legal = move_is_legal_##kernel;                           \
+} while (0)
+
+static int kernel_supported(int kernel) {
+	switch (kernel) {
+#ifdef CPU_DISPATCH
+	case KERNEL_POPCNT:
+		return cpu_has(CPU_POPCNT);
+	case KERNEL_BMI2:
+		return cpu_has(CPU_POPCNT | CPU_BMI1 | CPU_BMI2 | CPU_AVX2);
+#endif
+#ifdef BMI2
+	/* the only kernel is built with bmi2, it takes the pext paths */
+	case KERNEL_BMI2:
+		return 1;
+#else
+	case KERNEL_GENERIC:
+		return 1;
+#endif
+	default:
+		return 0;
+	}
 }
 
-move *generate_white(struct position *pos, move *move_list) {
-	move *move_ptr = move_list;
-	uint8_t i;
-
-	uint64_t piece;
-	uint64_t attacks;
-	uint64_t pinned_squares;
-
-	uint64_t checkers = generate_checkers_white(pos);
-	uint64_t attacked = generate_attacked_white(pos);
-	uint64_t pinned = generate_pinned_white(pos);
-
-	uint8_t target_square;
-	uint8_t source_square;
-	uint8_t king_square;
-
-	king_square = ctz(pos->white_pieces[king]);
-
-	if (checkers) {
-		if (checkers & (checkers - 1)) {
-			attacks = white_king_attacks(king_square, pos->white_pieces[all]) & ~attacked;
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(king_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-		}
-		else {
-			source_square = ctz(checkers);
-			pinned_squares = between_lookup[source_square + 64 * king_square] | checkers;
-			piece = white_pawn_push(pos->white_pieces[pawn], pos->pieces) & shift_south(pinned_squares) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (48 <= source_square) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square + 8, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square + 8, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = white_pawn_double_push(pos->white_pieces[pawn], pos->pieces) & shift_south_south(pinned_squares) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				*move_ptr++ = new_move(source_square, source_square + 16, 0, 0);
-				piece = clear_ls1b(piece);
-			}
-
-			piece = white_pawn_capture_e(pos->white_pieces[pawn], checkers) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (48 <= source_square) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square + 9, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square + 9, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = white_pawn_capture_w(pos->white_pieces[pawn], checkers) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (48 <= source_square) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square + 7, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square + 7, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			if (pos->en_passant) {
-				target_square = pos->en_passant;
-
-				piece = white_pawn_capture_e(pos->white_pieces[pawn], shift_north(checkers) & bitboard(target_square)) & ~pinned;
-				if (piece) {
-					source_square = ctz(piece);
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				piece = white_pawn_capture_w(pos->white_pieces[pawn], shift_north(checkers) & bitboard(target_square)) & ~pinned;
-				if (piece) {
-					source_square = ctz(piece);
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-
-			piece = pos->white_pieces[knight] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = white_knight_attacks(source_square, pos->white_pieces[all]) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->white_pieces[bishop] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = white_bishop_attacks(source_square, pos->white_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->white_pieces[rook] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = white_rook_attacks(source_square, pos->white_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->white_pieces[queen] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = white_queen_attacks(source_square, pos->white_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			attacks = white_king_attacks(king_square, pos->white_pieces[all]) & ~attacked;
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(king_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-		}
+/* picks the best kernel the cpu supports, which can be overridden by
+ * setting BITBIT_KERNEL to the name of a kernel. Must be called after
+ * cpu_init and before magic_bitboard_init, since the slider tables are
+ * laid out for the kernel.
+ */
+void move_gen_init() {
+	int kernel, i;
+	char *env;
+
+#ifdef BMI2
+	kernel = KERNEL_BMI2;
+#else
+	if (kernel_supported(KERNEL_BMI2) && !cpu_has(CPU_SLOW_PEXT))
+		kernel = KERNEL_BMI2;
+	else if (kernel_supported(KERNEL_POPCNT))
+		kernel = KERNEL_POPCNT;
+	else
+		kernel = KERNEL_GENERIC;
+#endif
+
+	env = getenv("BITBIT_KERNEL");
+	if (env) {
+		for (i = 0; i < KERNELS; i++)
+			if (strcmp(env, kernel_name[i]) == 0)
+				break;
+		if (i == KERNELS)
+			printf("error: unknown kernel %s\n", env);
+		else if (!kernel_supported(i))
+			printf("error: kernel %s is not supported\n", env);
+		else
+			kernel = i;
 	}
-	else {
-		piece = white_pawn_push(pos->white_pieces[pawn], pos->pieces) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (48 <= source_square) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square + 8, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square + 8, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_push(pos->white_pieces[pawn], pos->pieces) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if ((source_square - king_square) % 8 == 0) {
-				*move_ptr++ = new_move(source_square, source_square + 8, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
 
-		piece = white_pawn_double_push(pos->white_pieces[pawn], pos->pieces) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			*move_ptr++ = new_move(source_square, source_square + 16, 0, 0);
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_double_push(pos->white_pieces[pawn], pos->pieces) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if ((source_square - king_square) % 8 == 0) {
-				*move_ptr++ = new_move(source_square, source_square + 16, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_capture_e(pos->white_pieces[pawn], pos->black_pieces[all]) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (48 <= source_square) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square + 9, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square + 9, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_capture_e(pos->white_pieces[pawn], pos->black_pieces[all]) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square % 8 > king_square % 8 && source_square / 8 > king_square / 8) {
-				if (48 <= source_square) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square + 9, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square + 9, 0, 0);
-				}
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_capture_w(pos->white_pieces[pawn], pos->black_pieces[all]) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (48 <= source_square) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square + 7, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square + 7, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = white_pawn_capture_w(pos->white_pieces[pawn], pos->black_pieces[all]) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square % 8 < king_square % 8 && source_square / 8 > king_square / 8) {
-				if (48 <= source_square) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square + 7, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square + 7, 0, 0);
-				}
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		if (pos->en_passant) {
-			target_square = pos->en_passant;
-
-			uint64_t target_bitboard = bitboard(target_square);
-
-			piece = white_pawn_capture_e(pos->white_pieces[pawn], target_bitboard) & ~pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				pos->pieces ^= target_bitboard | shift_south(target_bitboard) | shift_south_west(target_bitboard);
-
-				if (!(rook_attacks(king_square, pos->pieces) & (pos->black_pieces[rook] | pos->black_pieces[queen])) && !(bishop_attacks(king_square, pos->pieces) & (pos->black_pieces[bishop] | pos->black_pieces[queen]))) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				pos->pieces ^= target_bitboard | shift_south(target_bitboard) | shift_south_west(target_bitboard);
-
-			}
-
-			piece = white_pawn_capture_e(pos->white_pieces[pawn], target_bitboard) & pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-
-			piece = white_pawn_capture_w(pos->white_pieces[pawn], target_bitboard) & ~pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				pos->pieces ^= target_bitboard | shift_south(target_bitboard) | shift_south_east(target_bitboard);
-
-				if (!(rook_attacks(king_square, pos->pieces) & (pos->black_pieces[rook] | pos->black_pieces[queen])) && !(bishop_attacks(king_square, pos->pieces) & (pos->black_pieces[bishop] | pos->black_pieces[queen]))) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				pos->pieces ^= target_bitboard | shift_south(target_bitboard) | shift_south_east(target_bitboard);
-
-			}
-
-			piece = white_pawn_capture_w(pos->white_pieces[pawn], target_bitboard) & pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-		}
-
-		piece = pos->white_pieces[knight] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_knight_attacks(source_square, pos->white_pieces[all]);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[bishop] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_bishop_attacks(source_square, pos->white_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[bishop] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_bishop_attacks(source_square, pos->white_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[rook] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_rook_attacks(source_square, pos->white_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[rook] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_rook_attacks(source_square, pos->white_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[queen] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_queen_attacks(source_square, pos->white_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->white_pieces[queen] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = white_queen_attacks(source_square, pos->white_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		attacks = white_king_attacks(king_square, pos->white_pieces[all]) & ~attacked;
-		while (attacks) {
-			target_square = ctz(attacks);
-
-			*move_ptr++ = new_move(king_square, target_square, 0, 0);
-
-			attacks = clear_ls1b(attacks);
-		}
-
-		if (pos->castle & 0x1) {
-			if (!(pos->pieces & 0x60)) {
-				if (!(attacked & 0x60)) {
-					*move_ptr++ = new_move(4, 6, 3, 0);
-				}
-			}
-		}
-		if (pos->castle & 0x2) {
-			if (!(pos->pieces & 0xE)) {
-				if (!(attacked & 0xC)) {
-					*move_ptr++ = new_move(4, 2, 3, 0);
-				}
-			}
-		}
+	switch (kernel) {
+#ifdef CPU_DISPATCH
+	case KERNEL_POPCNT:
+		KERNEL_SELECT(popcnt);
+		break;
+	case KERNEL_BMI2:
+		KERNEL_SELECT(bmi2);
+		break;
+#endif
+	default:
+		/* also the bmi2 kernel of a BMI2 build */
+		KERNEL_SELECT(generic);
 	}
-
-	/* set the terminating move */
-	*move_ptr = 0;
-	return move_ptr;
+	move_gen_kernel = kernel;
 }
-move *generate_black(struct position *pos, move *move_list) {
-	move *move_ptr = move_list;
-	uint8_t i;
-
-	uint64_t piece;
-	uint64_t attacks;
-	uint64_t pinned_squares;
 
-	uint64_t checkers = generate_checkers_black(pos);
-	uint64_t attacked = generate_attacked_black(pos);
-	uint64_t pinned = generate_pinned_black(pos);
-
-	uint8_t target_square;
-	uint8_t source_square;
-	uint8_t king_square;
-
-	king_square = ctz(pos->black_pieces[king]);
-	if (checkers) {
-		if (checkers & (checkers - 1)) {
-			attacks = black_king_attacks(king_square, pos->black_pieces[all]) & ~attacked;
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(king_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-		}
-		else {
-			source_square = ctz(checkers);
-			pinned_squares = between_lookup[source_square + 64 * king_square] | checkers;
-			piece = black_pawn_push(pos->black_pieces[pawn], pos->pieces) & shift_north(pinned_squares) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (source_square < 16) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square - 8, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square - 8, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = black_pawn_double_push(pos->black_pieces[pawn], pos->pieces) & shift_north_north(pinned_squares) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				*move_ptr++ = new_move(source_square, source_square - 16, 0, 0);
-				piece = clear_ls1b(piece);
-			}
-
-			piece = black_pawn_capture_e(pos->black_pieces[pawn], checkers) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (source_square < 16) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square - 7, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square - 7, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = black_pawn_capture_w(pos->black_pieces[pawn], checkers) & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				if (source_square < 16) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square - 9, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square - 9, 0, 0);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			if (pos->en_passant) {
-				target_square = pos->en_passant;
-
-				piece = black_pawn_capture_e(pos->black_pieces[pawn], shift_south(checkers) & bitboard(target_square)) & ~pinned;
-				if (piece) {
-					source_square = ctz(piece);
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				piece = black_pawn_capture_w(pos->black_pieces[pawn], shift_south(checkers) & bitboard(target_square)) & ~pinned;
-				if (piece) {
-					source_square = ctz(piece);
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-
-			piece = pos->black_pieces[knight] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = black_knight_attacks(source_square, pos->black_pieces[all]) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->black_pieces[bishop] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = black_bishop_attacks(source_square, pos->black_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->black_pieces[rook] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = black_rook_attacks(source_square, pos->black_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			piece = pos->black_pieces[queen] & ~pinned;
-			while (piece) {
-				source_square = ctz(piece);
-				attacks = black_queen_attacks(source_square, pos->black_pieces[all], pos->pieces) & pinned_squares;
-				while (attacks) {
-					target_square = ctz(attacks);
-
-					*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-					attacks = clear_ls1b(attacks);
-				}
-				piece = clear_ls1b(piece);
-			}
-
-			attacks = black_king_attacks(king_square, pos->black_pieces[all]) & ~attacked;
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(king_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-		}
-	}
-	else {
-		piece = black_pawn_push(pos->black_pieces[pawn], pos->pieces) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square < 16) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square - 8, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square - 8, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_push(pos->black_pieces[pawn], pos->pieces) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if ((source_square - king_square) % 8 == 0) {
-				*move_ptr++ = new_move(source_square, source_square - 8, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_double_push(pos->black_pieces[pawn], pos->pieces) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-
-			*move_ptr++ = new_move(source_square, source_square - 16, 0, 0);
-
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_double_push(pos->black_pieces[pawn], pos->pieces) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if ((source_square - king_square) % 8 == 0) {
-				*move_ptr++ = new_move(source_square, source_square - 16, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_capture_e(pos->black_pieces[pawn], pos->white_pieces[all]) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square < 16) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square - 7, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square - 7, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_capture_e(pos->black_pieces[pawn], pos->white_pieces[all]) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square % 8 > king_square % 8 && source_square / 8 < king_square / 8) {
-				if (source_square < 16) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square - 7, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square - 7, 0, 0);
-				}
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_capture_w(pos->black_pieces[pawn], pos->white_pieces[all]) & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square < 16) {
-				for (i = 0; i < 4; i++) {
-					*move_ptr++ = new_move(source_square, source_square - 9, 2, i);
-				}
-			}
-			else {
-				*move_ptr++ = new_move(source_square, source_square - 9, 0, 0);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = black_pawn_capture_w(pos->black_pieces[pawn], pos->white_pieces[all]) & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			if (source_square % 8 < king_square % 8 && source_square / 8 < king_square / 8) {
-				if (source_square < 16) {
-					for (i = 0; i < 4; i++) {
-						*move_ptr++ = new_move(source_square, source_square - 9, 2, i);
-					}
-				}
-				else {
-					*move_ptr++ = new_move(source_square, source_square - 9, 0, 0);
-				}
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		if (pos->en_passant) {
-			target_square = pos->en_passant;
-
-			uint64_t target_bitboard = bitboard(target_square);
-
-			piece = black_pawn_capture_e(pos->black_pieces[pawn], target_bitboard) & ~pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				pos->pieces ^= target_bitboard | shift_north(target_bitboard) | shift_north_west(target_bitboard);
-
-				if (!(rook_attacks(king_square, pos->pieces) & (pos->white_pieces[rook] | pos->white_pieces[queen])) && !(bishop_attacks(king_square, pos->pieces) & (pos->white_pieces[bishop] | pos->white_pieces[queen]))) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				pos->pieces ^= target_bitboard | shift_north(target_bitboard) | shift_north_west(target_bitboard);
-
-			}
-
-			piece = black_pawn_capture_e(pos->black_pieces[pawn], target_bitboard) & pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-
-			piece = black_pawn_capture_w(pos->black_pieces[pawn], target_bitboard) & ~pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				pos->pieces ^= target_bitboard | shift_north(target_bitboard) | shift_north_east(target_bitboard);
-
-				if (!(rook_attacks(king_square, pos->pieces) & (pos->white_pieces[rook] | pos->white_pieces[queen])) && !(bishop_attacks(king_square, pos->pieces) & (pos->white_pieces[bishop] | pos->white_pieces[queen]))) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-
-				pos->pieces ^= target_bitboard | shift_north(target_bitboard) | shift_north_east(target_bitboard);
-
-			}
-
-			piece = black_pawn_capture_w(pos->black_pieces[pawn], target_bitboard) & pinned;
-			if (piece) {
-				source_square = ctz(piece);
-
-				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
-					*move_ptr++ = new_move(source_square, target_square, 1, 0);
-				}
-			}
-		}
-
-		piece = pos->black_pieces[knight] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_knight_attacks(source_square, pos->black_pieces[all]);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[bishop] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_bishop_attacks(source_square, pos->black_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[bishop] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_bishop_attacks(source_square, pos->black_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[rook] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_rook_attacks(source_square, pos->black_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[rook] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_rook_attacks(source_square, pos->black_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[queen] & ~pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_queen_attacks(source_square, pos->black_pieces[all], pos->pieces);
-			while (attacks) {
-				target_square = ctz(attacks);
-
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
-
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
-
-		piece = pos->black_pieces[queen] & pinned;
-		while (piece) {
-			source_square = ctz(piece);
-			attacks = black_queen_attacks(source_square, pos->black_pieces[all], pos->pieces) & line_lookup[source_square + 64 * king_square];
-			while (attacks) {
-				target_square = ctz(attacks);
+const char *move_gen_kernel_name() {
+	return kernel_name[move_gen_kernel];
+}
 
-				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+int move_gen_pext() {
+#ifdef BMI2
+	return 1;
+#else
+	return move_gen_kernel == KERNEL_BMI2;
+#endif
+}
 
-				attacks = clear_ls1b(attacks);
-			}
-			piece = clear_ls1b(piece);
-		}
+int move_gen_popcnt() {
+#ifdef __POPCNT__
+	return 1;
+#else
+	return move_gen_kernel != KERNEL_GENERIC;
+#endif
+}
 
-		attacks = black_king_attacks(king_square, pos->black_pieces[all]) & ~attacked;
-		while (attacks) {
-			target_square = ctz(attacks);
+move *generate_all(struct position *pos, move *move_list) {
+	return pos->turn ? generate_white(pos, move_list) : generate_black(pos, move_list);
+}
 
-			*move_ptr++ = new_move(king_square, target_square, 0, 0);
+move *generate_captures_all(struct position *pos, move *move_list) {
+	return pos->turn ? generate_captures_white(pos, move_list) : generate_captures_black(pos, move_list);
+}
 
-			attacks = clear_ls1b(attacks);
-		}
+move *generate_quiets_all(struct position *pos, move *move_list) {
+	return pos->turn ? generate_quiets_white(pos, move_list) : generate_quiets_black(pos, move_list);
+}
 
-		if (pos->castle & 0x4) {
-			if (!(pos->pieces & 0x6000000000000000)) {
-				if (!(attacked & 0x6000000000000000)) {
-					*move_ptr++ = new_move(60, 62, 3, 0);
-				}
-			}
+uint64_t count_all(struct position *pos) {
+	return pos->turn ? count_white(pos) : count_black(pos);
+}
 
-		}
-		if (pos->castle & 0x8) {
-			if (!(pos->pieces & 0xE00000000000000)) {
-				if (!(attacked & 0xC00000000000000)) {
-					*move_ptr++ = new_move(60, 58, 3, 0);
-				}
-			}
-		}
+/* every 16 bit move is legal exactly if it is generated by generate_all.
+ * The positions are random but the same on every run.
+ */
+uint64_t move_gen_check(int positions) {
+	struct position pos;
+	struct rand_state state;
+	move move_list[256];
+	uint8_t *generated = calloc(0x10000, 1);
+	uint64_t errors = 0;
+	char fen[128];
+	move m;
+	if (!generated)
+		return 0;
+	rand_seed(&state, 0);
+	for (int i = 0; i < positions; i++) {
+		random_pos(&pos, rand_below(&state, 400), &state);
+		generate_all(&pos, move_list);
+		for (move *ptr = move_list; *ptr; ptr++)
+			generated[*ptr] = 1;
+		for (uint32_t j = 0; j < 0x10000; j++) {
+			m = j;
+			if (move_is_legal(&pos, m) != generated[j] && errors++ < 16) {
+				printf("error: move_is_legal is %i for ", !generated[j]);
+				print_move(&m);
+				printf(" in %s\n", pos_to_fen(fen, &pos));
+			}
+		}
+		for (move *ptr = move_list; *ptr; ptr++)
+			generated[*ptr] = 0;
 	}
-
-	/* set the terminating move */
-	*move_ptr = 0;
-	return move_ptr;
+	free(generated);
+	printf("positions: %i, errors: %" PRIu64 "\n", positions, errors);
+	return errors;
 }
 
 int move_count(move *m) {
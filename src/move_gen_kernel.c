@@ -0,0 +1,1222 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file is compiled once for every kernel in move_gen_kernel.h,
+ * each time with its own instruction set flags. KERNEL is the name of the
+ * kernel and is appended to every exported function. The white and black
+ * functions are selected at startup by move_gen_init.
+ */
+
+#include "move_gen_kernel.h"
+
+#include <stdlib.h>
+
+#include "bitboard.h"
+#include "attack_gen.h"
+#include "util.h"
+
+#ifndef KERNEL
+#define KERNEL generic
+#endif
+
+static inline int pawn_promotes(const int us, int square) {
+	return us ? 48 <= square : square < 16;
+}
+
+static inline int rank_ahead(const int us, int square, int other) {
+	return us ? square / 8 > other / 8 : square / 8 < other / 8;
+}
+
+static ALWAYS_INLINE uint64_t generate_checkers_side(struct position *pos, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	uint64_t checkers = 0;
+	int square;
+
+	square = ctz(own[king]);
+	checkers |= (shift_forward(us, shift_west(own[king])) | shift_forward(us, shift_east(own[king]))) & enemy[pawn];
+	checkers |= rook_attacks(square, pos->pieces) & (enemy[rook] | enemy[queen]);
+	checkers |= bishop_attacks(square, pos->pieces) & (enemy[bishop] | enemy[queen]);
+	checkers |= knight_attacks(square) & enemy[knight];
+
+	return checkers;
+}
+
+/* squares attacked by the enemy of us, seen through our king */
+static ALWAYS_INLINE uint64_t generate_attacked_side(struct position *pos, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	uint64_t attacked = 0;
+	uint64_t piece;
+	int square;
+
+	square = ctz(enemy[king]);
+
+	attacked = king_attacks(square);
+	attacked |= shift_backward_west(us, enemy[pawn]);
+	attacked |= shift_backward_east(us, enemy[pawn]);
+
+	piece = enemy[knight];
+	while (piece) {
+		square = ctz(piece);
+		attacked |= knight_attacks(square);
+		piece = clear_ls1b(piece);
+	}
+
+	piece = enemy[bishop] | enemy[queen];
+	while (piece) {
+		square = ctz(piece);
+		attacked |= bishop_attacks(square, pos->pieces ^ own[king]);
+		piece = clear_ls1b(piece);
+	}
+
+	piece = enemy[rook] | enemy[queen];
+	while (piece) {
+		square = ctz(piece);
+		attacked |= rook_attacks(square, pos->pieces ^ own[king]);
+		piece = clear_ls1b(piece);
+	}
+
+	return attacked;
+}
+
+static ALWAYS_INLINE uint64_t generate_pinned_side(struct position *pos, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	uint64_t pinned_all = 0;
+	int king_square;
+	int square;
+	uint64_t rook_pinners;
+	uint64_t bishop_pinners;
+	uint64_t pinned;
+
+	king_square = ctz(own[king]);
+	rook_pinners = rook_attacks(king_square, enemy[all]) & (enemy[rook] | enemy[queen]);
+	bishop_pinners = bishop_attacks(king_square, enemy[all]) & (enemy[bishop] | enemy[queen]);
+
+	while (rook_pinners) {
+		square = ctz(rook_pinners);
+
+		pinned = between_lookup[square + 64 * king_square] & own[all];
+		if (single(pinned)) {
+			pinned_all |= pinned;
+		}
+
+		rook_pinners = clear_ls1b(rook_pinners);
+	}
+
+	while (bishop_pinners) {
+		square = ctz(bishop_pinners);
+
+		pinned = between_lookup[square + 64 * king_square] & own[all];
+		if (single(pinned)) {
+			pinned_all |= pinned;
+		}
+
+		bishop_pinners = clear_ls1b(bishop_pinners);
+	}
+
+	return pinned_all;
+}
+
+/* us is 1 for white and 0 for black. The generic functions are always
+ * inlined into their white and black versions, so the color is resolved
+ * at compile time. generate gives all legal moves, or if quiets is set
+ * only the moves which generate_captures does not give. Those are the
+ * moves to empty squares except queen promotions, and the
+ * underpromotions.
+ */
+static ALWAYS_INLINE move *generate(struct position *pos, move *move_list, const int us, const int quiets) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	const int up = us ? 8 : -8;
+	const int back = us ? 0 : 56;
+	const uint64_t rank_7 = us ? RANK_7 : RANK_2;
+	move *move_ptr = move_list;
+	uint8_t i;
+
+	uint64_t piece;
+	uint64_t attacks;
+	uint64_t pinned_squares;
+
+	uint64_t checkers = generate_checkers_side(pos, us);
+	uint64_t attacked = generate_attacked_side(pos, us);
+	uint64_t pinned = generate_pinned_side(pos, us);
+
+	uint8_t target_square;
+	uint8_t source_square;
+	uint8_t king_square;
+
+	/* the quiet pawn captures are the underpromotions */
+	const int promotions = quiets ? 3 : 4;
+	const uint64_t targets = quiets ? ~pos->pieces : ~own[all];
+	const uint64_t capturers = quiets ? own[pawn] & rank_7 : own[pawn];
+
+	king_square = ctz(own[king]);
+
+	if (checkers) {
+		if (checkers & (checkers - 1)) {
+			attacks = king_attacks(king_square) & targets & ~attacked;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(king_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+		}
+		else {
+			source_square = ctz(checkers);
+			pinned_squares = between_lookup[source_square + 64 * king_square] | checkers;
+			piece = pawn_push(us, own[pawn], pos->pieces) & shift_backward(us, pinned_squares) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				if (pawn_promotes(us, source_square)) {
+					for (i = 0; i < promotions; i++) {
+						*move_ptr++ = new_move(source_square, source_square + up, 2, i);
+					}
+				}
+				else {
+					*move_ptr++ = new_move(source_square, source_square + up, 0, 0);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			piece = pawn_double_push(us, own[pawn], pos->pieces) & shift_backward_backward(us, pinned_squares) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				*move_ptr++ = new_move(source_square, source_square + 2 * up, 0, 0);
+				piece = clear_ls1b(piece);
+			}
+
+			piece = pawn_capture_e(us, capturers, checkers) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				if (pawn_promotes(us, source_square)) {
+					for (i = 0; i < promotions; i++) {
+						*move_ptr++ = new_move(source_square, source_square + up + 1, 2, i);
+					}
+				}
+				else {
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			piece = pawn_capture_w(us, capturers, checkers) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				if (pawn_promotes(us, source_square)) {
+					for (i = 0; i < promotions; i++) {
+						*move_ptr++ = new_move(source_square, source_square + up - 1, 2, i);
+					}
+				}
+				else {
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			if (!quiets && pos->en_passant) {
+				target_square = pos->en_passant;
+
+				piece = pawn_capture_e(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned;
+				if (piece) {
+					source_square = ctz(piece);
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				piece = pawn_capture_w(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned;
+				if (piece) {
+					source_square = ctz(piece);
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+
+			piece = own[knight] & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				attacks = knight_attacks(source_square) & targets & pinned_squares;
+				while (attacks) {
+					target_square = ctz(attacks);
+					*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+					attacks = clear_ls1b(attacks);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			piece = own[bishop] & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				attacks = bishop_attacks(source_square, pos->pieces) & targets & pinned_squares;
+				while (attacks) {
+					target_square = ctz(attacks);
+
+					*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+					attacks = clear_ls1b(attacks);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			piece = own[rook] & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				attacks = rook_attacks(source_square, pos->pieces) & targets & pinned_squares;
+				while (attacks) {
+					target_square = ctz(attacks);
+
+					*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+					attacks = clear_ls1b(attacks);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			piece = own[queen] & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				attacks = queen_attacks(source_square, pos->pieces) & targets & pinned_squares;
+				while (attacks) {
+					target_square = ctz(attacks);
+
+					*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+					attacks = clear_ls1b(attacks);
+				}
+				piece = clear_ls1b(piece);
+			}
+
+			attacks = king_attacks(king_square) & targets & ~attacked;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(king_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+		}
+	}
+	else {
+		piece = pawn_push(us, own[pawn], pos->pieces) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (pawn_promotes(us, source_square)) {
+				for (i = 0; i < promotions; i++) {
+					*move_ptr++ = new_move(source_square, source_square + up, 2, i);
+				}
+			}
+			else {
+				*move_ptr++ = new_move(source_square, source_square + up, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_push(us, own[pawn], pos->pieces) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if ((source_square - king_square) % 8 == 0) {
+				*move_ptr++ = new_move(source_square, source_square + up, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_double_push(us, own[pawn], pos->pieces) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			*move_ptr++ = new_move(source_square, source_square + 2 * up, 0, 0);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_double_push(us, own[pawn], pos->pieces) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if ((source_square - king_square) % 8 == 0) {
+				*move_ptr++ = new_move(source_square, source_square + 2 * up, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_e(us, capturers, enemy[all]) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (pawn_promotes(us, source_square)) {
+				for (i = 0; i < promotions; i++) {
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 2, i);
+				}
+			}
+			else {
+				*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_e(us, capturers, enemy[all]) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (source_square % 8 > king_square % 8 && rank_ahead(us, source_square, king_square)) {
+				if (pawn_promotes(us, source_square)) {
+					for (i = 0; i < promotions; i++) {
+						*move_ptr++ = new_move(source_square, source_square + up + 1, 2, i);
+					}
+				}
+				else {
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+				}
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_w(us, capturers, enemy[all]) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (pawn_promotes(us, source_square)) {
+				for (i = 0; i < promotions; i++) {
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 2, i);
+				}
+			}
+			else {
+				*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_w(us, capturers, enemy[all]) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (source_square % 8 < king_square % 8 && rank_ahead(us, source_square, king_square)) {
+				if (pawn_promotes(us, source_square)) {
+					for (i = 0; i < promotions; i++) {
+						*move_ptr++ = new_move(source_square, source_square + up - 1, 2, i);
+					}
+				}
+				else {
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+				}
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		if (!quiets && pos->en_passant) {
+			target_square = pos->en_passant;
+
+			uint64_t target_bitboard = bitboard(target_square);
+
+			piece = pawn_capture_e(us, own[pawn], target_bitboard) & ~pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+
+				if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen]))) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+
+			}
+
+			piece = pawn_capture_e(us, own[pawn], target_bitboard) & pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+
+			piece = pawn_capture_w(us, own[pawn], target_bitboard) & ~pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+
+				if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen]))) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+
+			}
+
+			piece = pawn_capture_w(us, own[pawn], target_bitboard) & pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+		}
+
+		piece = own[knight] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = knight_attacks(source_square) & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[bishop] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = bishop_attacks(source_square, pos->pieces) & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[bishop] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = bishop_attacks(source_square, pos->pieces) & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[rook] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = rook_attacks(source_square, pos->pieces) & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[rook] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = rook_attacks(source_square, pos->pieces) & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[queen] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = queen_attacks(source_square, pos->pieces) & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[queen] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = queen_attacks(source_square, pos->pieces) & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		attacks = king_attacks(king_square) & targets & ~attacked;
+		while (attacks) {
+			target_square = ctz(attacks);
+
+			*move_ptr++ = new_move(king_square, target_square, 0, 0);
+
+			attacks = clear_ls1b(attacks);
+		}
+
+		if (pos->castle & (us ? 0x1 : 0x4)) {
+			if (!(pos->pieces & ((uint64_t)0x60 << back))) {
+				if (!(attacked & ((uint64_t)0x60 << back))) {
+					*move_ptr++ = new_move(e1 + back, g1 + back, 3, 0);
+				}
+			}
+		}
+		if (pos->castle & (us ? 0x2 : 0x8)) {
+			if (!(pos->pieces & ((uint64_t)0xE << back))) {
+				if (!(attacked & ((uint64_t)0xC << back))) {
+					*move_ptr++ = new_move(e1 + back, c1 + back, 3, 0);
+				}
+			}
+		}
+	}
+
+	/* set the terminating move */
+	*move_ptr = 0;
+	return move_ptr;
+}
+
+static ALWAYS_INLINE move *generate_captures(struct position *pos, move *move_list, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	const int up = us ? 8 : -8;
+	const uint64_t rank_7 = us ? RANK_7 : RANK_2;
+	move *move_ptr = move_list;
+
+	uint64_t piece;
+	uint64_t attacks;
+	uint64_t targets = enemy[all];
+
+	uint64_t checkers = generate_checkers_side(pos, us);
+	uint64_t attacked = generate_attacked_side(pos, us);
+	uint64_t pinned = generate_pinned_side(pos, us);
+
+	uint8_t target_square;
+	uint8_t source_square;
+	uint8_t king_square;
+
+	king_square = ctz(own[king]);
+
+	if (checkers) {
+		if (!(checkers & (checkers - 1))) {
+			/* the only capture that can resolve the check is of the checker,
+			 * but a promotion can still block it.
+			 */
+			source_square = ctz(checkers);
+			piece = pawn_push(us, own[pawn] & rank_7, pos->pieces) & shift_backward(us, between_lookup[source_square + 64 * king_square]) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				*move_ptr++ = new_move(source_square, source_square + up, 2, 3);
+				piece = clear_ls1b(piece);
+			}
+
+			piece = pawn_capture_e(us, own[pawn], checkers) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				if (pawn_promotes(us, source_square))
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 2, 3);
+				else
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+				piece = clear_ls1b(piece);
+			}
+
+			piece = pawn_capture_w(us, own[pawn], checkers) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				if (pawn_promotes(us, source_square))
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 2, 3);
+				else
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+				piece = clear_ls1b(piece);
+			}
+
+			if (pos->en_passant) {
+				target_square = pos->en_passant;
+
+				piece = pawn_capture_e(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned;
+				if (piece) {
+					source_square = ctz(piece);
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				piece = pawn_capture_w(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned;
+				if (piece) {
+					source_square = ctz(piece);
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+
+			target_square = ctz(checkers);
+			piece = ((knight_attacks(target_square) & own[knight]) |
+				 (bishop_attacks(target_square, pos->pieces) & (own[bishop] | own[queen])) |
+				 (rook_attacks(target_square, pos->pieces) & (own[rook] | own[queen]))) & ~pinned;
+			while (piece) {
+				source_square = ctz(piece);
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+				piece = clear_ls1b(piece);
+			}
+		}
+
+		attacks = king_attacks(king_square) & ~own[all] & ~attacked & targets;
+		while (attacks) {
+			target_square = ctz(attacks);
+
+			*move_ptr++ = new_move(king_square, target_square, 0, 0);
+
+			attacks = clear_ls1b(attacks);
+		}
+	}
+	else {
+		/* a pinned pawn can never promote by a push */
+		piece = pawn_push(us, own[pawn] & rank_7, pos->pieces) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			*move_ptr++ = new_move(source_square, source_square + up, 2, 3);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_e(us, own[pawn], targets) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (pawn_promotes(us, source_square))
+				*move_ptr++ = new_move(source_square, source_square + up + 1, 2, 3);
+			else
+				*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_e(us, own[pawn], targets) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (source_square % 8 > king_square % 8 && rank_ahead(us, source_square, king_square)) {
+				if (pawn_promotes(us, source_square))
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 2, 3);
+				else
+					*move_ptr++ = new_move(source_square, source_square + up + 1, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_w(us, own[pawn], targets) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (pawn_promotes(us, source_square))
+				*move_ptr++ = new_move(source_square, source_square + up - 1, 2, 3);
+			else
+				*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = pawn_capture_w(us, own[pawn], targets) & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			if (source_square % 8 < king_square % 8 && rank_ahead(us, source_square, king_square)) {
+				if (pawn_promotes(us, source_square))
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 2, 3);
+				else
+					*move_ptr++ = new_move(source_square, source_square + up - 1, 0, 0);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		if (pos->en_passant) {
+			target_square = pos->en_passant;
+
+			uint64_t target_bitboard = bitboard(target_square);
+
+			piece = pawn_capture_e(us, own[pawn], target_bitboard) & ~pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+
+				if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen]))) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+
+			}
+
+			piece = pawn_capture_e(us, own[pawn], target_bitboard) & pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+
+			piece = pawn_capture_w(us, own[pawn], target_bitboard) & ~pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+
+				if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen]))) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+
+				pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+
+			}
+
+			piece = pawn_capture_w(us, own[pawn], target_bitboard) & pinned;
+			if (piece) {
+				source_square = ctz(piece);
+
+				if (target_bitboard & line_lookup[source_square + 64 * king_square]) {
+					*move_ptr++ = new_move(source_square, target_square, 1, 0);
+				}
+			}
+		}
+
+		piece = own[knight] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = knight_attacks(source_square) & ~own[all] & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[bishop] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = bishop_attacks(source_square, pos->pieces) & ~own[all] & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[bishop] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = bishop_attacks(source_square, pos->pieces) & ~own[all] & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[rook] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = rook_attacks(source_square, pos->pieces) & ~own[all] & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[rook] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = rook_attacks(source_square, pos->pieces) & ~own[all] & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[queen] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = queen_attacks(source_square, pos->pieces) & ~own[all] & targets;
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		piece = own[queen] & pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			attacks = queen_attacks(source_square, pos->pieces) & ~own[all] & targets & line_lookup[source_square + 64 * king_square];
+			while (attacks) {
+				target_square = ctz(attacks);
+
+				*move_ptr++ = new_move(source_square, target_square, 0, 0);
+
+				attacks = clear_ls1b(attacks);
+			}
+			piece = clear_ls1b(piece);
+		}
+
+		attacks = king_attacks(king_square) & ~own[all] & ~attacked & targets;
+		while (attacks) {
+			target_square = ctz(attacks);
+
+			*move_ptr++ = new_move(king_square, target_square, 0, 0);
+
+			attacks = clear_ls1b(attacks);
+		}
+	}
+
+	/* set the terminating move */
+	*move_ptr = 0;
+	return move_ptr;
+}
+
+/* counts the moves generate would generate without writing them */
+static ALWAYS_INLINE uint64_t count(struct position *pos, const int us) {
+	uint64_t *own = us ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = us ? pos->black_pieces : pos->white_pieces;
+	const int back = us ? 0 : 56;
+	const uint64_t rank_7 = us ? RANK_7 : RANK_2;
+	uint64_t count = 0;
+
+	uint64_t piece;
+	uint64_t attacks;
+	uint64_t pinned_squares;
+
+	uint64_t checkers = generate_checkers_side(pos, us);
+	uint64_t attacked = generate_attacked_side(pos, us);
+	uint64_t pinned = generate_pinned_side(pos, us);
+
+	uint8_t target_square;
+	uint8_t source_square;
+	uint8_t king_square;
+
+	king_square = ctz(own[king]);
+
+	count += popcount((king_attacks(king_square) & ~own[all]) & ~attacked);
+
+	if (checkers) {
+		if (checkers & (checkers - 1))
+			return count;
+
+		source_square = ctz(checkers);
+		pinned_squares = between_lookup[source_square + 64 * king_square] | checkers;
+
+		/* promotions count as 4 */
+		piece = pawn_push(us, own[pawn], pos->pieces) & shift_backward(us, pinned_squares) & ~pinned;
+		count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+		piece = pawn_double_push(us, own[pawn], pos->pieces) & shift_backward_backward(us, pinned_squares) & ~pinned;
+		count += popcount(piece);
+
+		piece = pawn_capture_e(us, own[pawn], checkers) & ~pinned;
+		count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+		piece = pawn_capture_w(us, own[pawn], checkers) & ~pinned;
+		count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+		if (pos->en_passant) {
+			target_square = pos->en_passant;
+			count += popcount(pawn_capture_e(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned);
+			count += popcount(pawn_capture_w(us, own[pawn], shift_forward(us, checkers) & bitboard(target_square)) & ~pinned);
+		}
+
+		piece = own[knight] & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			count += popcount((knight_attacks(source_square) & ~own[all]) & pinned_squares);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = (own[bishop] | own[queen]) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			count += popcount((bishop_attacks(source_square, pos->pieces) & ~own[all]) & pinned_squares);
+			piece = clear_ls1b(piece);
+		}
+
+		piece = (own[rook] | own[queen]) & ~pinned;
+		while (piece) {
+			source_square = ctz(piece);
+			count += popcount((rook_attacks(source_square, pos->pieces) & ~own[all]) & pinned_squares);
+			piece = clear_ls1b(piece);
+		}
+
+		return count;
+	}
+
+	piece = pawn_push(us, own[pawn], pos->pieces) & ~pinned;
+	count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+	/* a pinned pawn can only be pushed along the file of the king */
+	piece = pawn_push(us, own[pawn], pos->pieces) & pinned & (FILE_A << (king_square % 8));
+	count += popcount(piece);
+
+	piece = pawn_double_push(us, own[pawn], pos->pieces) & ~pinned;
+	count += popcount(piece);
+
+	piece = pawn_double_push(us, own[pawn], pos->pieces) & pinned & (FILE_A << (king_square % 8));
+	count += popcount(piece);
+
+	piece = pawn_capture_e(us, own[pawn], enemy[all]) & ~pinned;
+	count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+	piece = pawn_capture_e(us, own[pawn], enemy[all]) & pinned;
+	while (piece) {
+		source_square = ctz(piece);
+		if (source_square % 8 > king_square % 8 && rank_ahead(us, source_square, king_square))
+			count += (pawn_promotes(us, source_square)) ? 4 : 1;
+		piece = clear_ls1b(piece);
+	}
+
+	piece = pawn_capture_w(us, own[pawn], enemy[all]) & ~pinned;
+	count += popcount(piece & ~rank_7) + 4 * popcount(piece & rank_7);
+
+	piece = pawn_capture_w(us, own[pawn], enemy[all]) & pinned;
+	while (piece) {
+		source_square = ctz(piece);
+		if (source_square % 8 < king_square % 8 && rank_ahead(us, source_square, king_square))
+			count += (pawn_promotes(us, source_square)) ? 4 : 1;
+		piece = clear_ls1b(piece);
+	}
+
+	if (pos->en_passant) {
+		target_square = pos->en_passant;
+
+		uint64_t target_bitboard = bitboard(target_square);
+
+		piece = pawn_capture_e(us, own[pawn], target_bitboard) & ~pinned;
+		if (piece) {
+			pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+			if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen])))
+				count++;
+			pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_west(us, target_bitboard);
+		}
+
+		piece = pawn_capture_e(us, own[pawn], target_bitboard) & pinned;
+		if (piece && (target_bitboard & line_lookup[ctz(piece) + 64 * king_square]))
+			count++;
+
+		piece = pawn_capture_w(us, own[pawn], target_bitboard) & ~pinned;
+		if (piece) {
+			pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+			if (!(rook_attacks(king_square, pos->pieces) & (enemy[rook] | enemy[queen])) && !(bishop_attacks(king_square, pos->pieces) & (enemy[bishop] | enemy[queen])))
+				count++;
+			pos->pieces ^= target_bitboard | shift_backward(us, target_bitboard) | shift_backward_east(us, target_bitboard);
+		}
+
+		piece = pawn_capture_w(us, own[pawn], target_bitboard) & pinned;
+		if (piece && (target_bitboard & line_lookup[ctz(piece) + 64 * king_square]))
+			count++;
+	}
+
+	piece = own[knight] & ~pinned;
+	while (piece) {
+		source_square = ctz(piece);
+		count += popcount((knight_attacks(source_square) & ~own[all]));
+		piece = clear_ls1b(piece);
+	}
+
+	/* queens are counted as a bishop and a rook */
+	piece = own[bishop] | own[queen];
+	while (piece) {
+		source_square = ctz(piece);
+		attacks = bishop_attacks(source_square, pos->pieces) & ~own[all];
+		if (get_bit(pinned, source_square))
+			attacks &= line_lookup[source_square + 64 * king_square];
+		count += popcount(attacks);
+		piece = clear_ls1b(piece);
+	}
+
+	piece = own[rook] | own[queen];
+	while (piece) {
+		source_square = ctz(piece);
+		attacks = rook_attacks(source_square, pos->pieces) & ~own[all];
+		if (get_bit(pinned, source_square))
+			attacks &= line_lookup[source_square + 64 * king_square];
+		count += popcount(attacks);
+		piece = clear_ls1b(piece);
+	}
+
+	if (pos->castle & (us ? 0x1 : 0x4))
+		if (!(pos->pieces & ((uint64_t)0x60 << back)) && !(attacked & ((uint64_t)0x60 << back)))
+			count++;
+	if (pos->castle & (us ? 0x2 : 0x8))
+		if (!(pos->pieces & ((uint64_t)0xE << back)) && !(attacked & ((uint64_t)0xC << back)))
+			count++;
+
+	return count;
+}
+
+move *KERNEL_FUNCTION(generate_white)(struct position *pos, move *move_list) {
+	return generate(pos, move_list, 1, 0);
+}
+
+move *KERNEL_FUNCTION(generate_black)(struct position *pos, move *move_list) {
+	return generate(pos, move_list, 0, 0);
+}
+
+move *KERNEL_FUNCTION(generate_captures_white)(struct position *pos, move *move_list) {
+	return generate_captures(pos, move_list, 1);
+}
+
+move *KERNEL_FUNCTION(generate_captures_black)(struct position *pos, move *move_list) {
+	return generate_captures(pos, move_list, 0);
+}
+
+move *KERNEL_FUNCTION(generate_quiets_white)(struct position *pos, move *move_list) {
+	return generate(pos, move_list, 1, 1);
+}
+
+move *KERNEL_FUNCTION(generate_quiets_black)(struct position *pos, move *move_list) {
+	return generate(pos, move_list, 0, 1);
+}
+
+uint64_t KERNEL_FUNCTION(count_white)(struct position *pos) {
+	return count(pos, 1);
+}
+
+uint64_t KERNEL_FUNCTION(count_black)(struct position *pos) {
+	return count(pos, 0);
+}
+
+uint64_t KERNEL_FUNCTION(generate_checkers_white)(struct position *pos) {
+	return generate_checkers_side(pos, 1);
+}
+
+uint64_t KERNEL_FUNCTION(generate_checkers_black)(struct position *pos) {
+	return generate_checkers_side(pos, 0);
+}
+
+uint64_t KERNEL_FUNCTION(generate_attacked_white)(struct position *pos) {
+	return generate_attacked_side(pos, 1);
+}
+
+uint64_t KERNEL_FUNCTION(generate_attacked_black)(struct position *pos) {
+	return generate_attacked_side(pos, 0);
+}
+
+uint64_t KERNEL_FUNCTION(generate_pinned_white)(struct position *pos) {
+	return generate_pinned_side(pos, 1);
+}
+
+uint64_t KERNEL_FUNCTION(generate_pinned_black)(struct position *pos) {
+	return generate_pinned_side(pos, 0);
+}
+
+/* checks if a move from outside of the move generation, such as a hash
+ * or killer move, is legal without generating any moves.
+ */
+int KERNEL_FUNCTION(move_is_legal)(struct position *pos, move m) {
+	uint8_t source_square = move_from(&m);
+	uint8_t target_square = move_to(&m);
+	uint8_t flag = move_flag(&m);
+
+	uint64_t from = bitboard(source_square);
+	uint64_t to = bitboard(target_square);
+	uint64_t *own = pos->turn ? pos->white_pieces : pos->black_pieces;
+	uint64_t *enemy = pos->turn ? pos->black_pieces : pos->white_pieces;
+	uint64_t attacks, push;
+	int piece = pos->mailbox[source_square] - (pos->turn ? 0 : 6);
+	int legal;
+	struct undo u;
+
+	if (!(from & own[all]) || (to & own[all]) || (flag != 2 && move_promote(&m)))
+		return 0;
+
+	switch (piece) {
+	case pawn:
+		if (flag == 3)
+			return 0;
+		attacks = pos->turn ? shift_north_west(from) | shift_north_east(from) : shift_south_west(from) | shift_south_east(from);
+		if (flag == 1) {
+			if (!pos->en_passant || target_square != pos->en_passant || !(attacks & to))
+				return 0;
+			break;
+		}
+		if ((flag == 2) != !!(to & (RANK_1 | RANK_8)))
+			return 0;
+		push = (pos->turn ? shift_north(from) : shift_south(from)) & ~pos->pieces;
+		attacks &= enemy[all];
+		attacks |= push;
+		attacks |= (pos->turn ? shift_north(push & RANK_3) : shift_south(push & RANK_6)) & ~pos->pieces;
+		break;
+	case knight:
+		attacks = knight_attacks(source_square);
+		break;
+	case bishop:
+		attacks = bishop_attacks(source_square, pos->pieces);
+		break;
+	case rook:
+		attacks = rook_attacks(source_square, pos->pieces);
+		break;
+	case queen:
+		attacks = queen_attacks(source_square, pos->pieces);
+		break;
+	case king:
+		if (flag == 3) {
+			if (pos->turn) {
+				if (generate_checkers_side(pos, 1))
+					return 0;
+				if (source_square == e1 && target_square == g1)
+					return (pos->castle & 0x1) && !(pos->pieces & 0x60) && !(generate_attacked_side(pos, 1) & 0x60);
+				if (source_square == e1 && target_square == c1)
+					return (pos->castle & 0x2) && !(pos->pieces & 0xE) && !(generate_attacked_side(pos, 1) & 0xC);
+			}
+			else {
+				if (generate_checkers_side(pos, 0))
+					return 0;
+				if (source_square == e8 && target_square == g8)
+					return (pos->castle & 0x4) && !(pos->pieces & 0x6000000000000000) && !(generate_attacked_side(pos, 0) & 0x6000000000000000);
+				if (source_square == e8 && target_square == c8)
+					return (pos->castle & 0x8) && !(pos->pieces & 0xE00000000000000) && !(generate_attacked_side(pos, 0) & 0xC00000000000000);
+			}
+			return 0;
+		}
+		/* generate_checkers_side does not look for the enemy king */
+		attacks = king_attacks(source_square) & ~king_attacks(ctz(enemy[king]));
+		break;
+	default:
+		return 0;
+	}
+
+	if (!(attacks & to) || (piece != pawn && flag))
+		return 0;
+
+	/* the move is pseudo legal, it is legal if it does not leave the
+	 * king in check.
+	 */
+	do_move(pos, &m, &u);
+	legal = !(pos->turn ? generate_checkers_side(pos, 0) : generate_checkers_side(pos, 1));
+	undo_move(pos, &m, &u);
+	return legal;
+}
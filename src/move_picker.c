@@ -0,0 +1,121 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "move_picker.h"
+
+#include "move_gen.h"
+
+/* captures, en passant and queen promotions, the moves generated by
+ * generate_captures_all.
+ */
+int move_is_tactical(struct position *pos, move m) {
+	if (move_flag(&m) == 1)
+		return 1;
+	if (move_flag(&m) == 2)
+		return move_promote(&m) == 3;
+	return pos->mailbox[move_to(&m)] != empty;
+}
+
+void store_killer(move *killer, move m) {
+	if (killer[0] != m) {
+		killer[1] = killer[0];
+		killer[0] = m;
+	}
+}
+
+void move_picker_init(struct move_picker *mp, struct position *pos, move hash_move, move *killer) {
+	mp->pos = pos;
+	mp->stage = STAGE_HASH;
+	mp->hash_move = hash_move;
+	mp->killer[0] = killer ? killer[0] : 0;
+	mp->killer[1] = killer ? killer[1] : 0;
+	mp->index = 0;
+	mp->end = 0;
+}
+
+/* most valuable victim, least valuable attacker */
+static inline int16_t mvv_lva(struct position *pos, move m) {
+	int victim = pos->mailbox[move_to(&m)] ? (pos->mailbox[move_to(&m)] - 1) % 6 + 1 : 0;
+	int attacker = (pos->mailbox[move_from(&m)] - 1) % 6 + 1;
+	if (move_flag(&m) == 1)
+		victim = pawn;
+	/* a queen promotion is worth about as much as capturing a queen */
+	if (move_flag(&m) == 2)
+		victim += queen;
+	return 8 * victim - attacker;
+}
+
+move move_picker_next(struct move_picker *mp) {
+	struct position *pos = mp->pos;
+	move m;
+	int i, best;
+
+	switch (mp->stage) {
+	case STAGE_HASH:
+		mp->stage++;
+		if (mp->hash_move && move_is_legal(pos, mp->hash_move))
+			return mp->hash_move;
+		mp->hash_move = 0;
+		/* fallthrough */
+	case STAGE_CAPTURES_GEN:
+		mp->end = generate_captures_all(pos, mp->move_list) - mp->move_list;
+		for (i = 0; i < mp->end; i++)
+			mp->score[i] = mvv_lva(pos, mp->move_list[i]);
+		mp->index = 0;
+		mp->stage++;
+		/* fallthrough */
+	case STAGE_CAPTURES:
+		/* selection sort, most nodes cut off after a few captures */
+		while (mp->index < mp->end) {
+			best = mp->index;
+			for (i = mp->index + 1; i < mp->end; i++)
+				if (mp->score[i] > mp->score[best])
+					best = i;
+			m = mp->move_list[best];
+			mp->move_list[best] = mp->move_list[mp->index];
+			mp->score[best] = mp->score[mp->index];
+			mp->index++;
+			if (m != mp->hash_move)
+				return m;
+		}
+		mp->index = 0;
+		mp->stage++;
+		/* fallthrough */
+	case STAGE_KILLERS:
+		while (mp->index < 2) {
+			m = mp->killer[mp->index++];
+			if (m && m != mp->hash_move && !move_is_tactical(pos, m) && move_is_legal(pos, m))
+				return m;
+		}
+		mp->stage++;
+		/* fallthrough */
+	case STAGE_QUIETS_GEN:
+		mp->end = generate_quiets_all(pos, mp->move_list) - mp->move_list;
+		mp->index = 0;
+		mp->stage++;
+		/* fallthrough */
+	case STAGE_QUIETS:
+		while (mp->index < mp->end) {
+			m = mp->move_list[mp->index++];
+			if (m != mp->hash_move && m != mp->killer[0] && m != mp->killer[1])
+				return m;
+		}
+		mp->stage++;
+		/* fallthrough */
+	default:
+		return 0;
+	}
+}
@@ -19,29 +19,96 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <inttypes.h>
+#include <pthread.h>
 
+#include "bitboard.h"
 #include "move.h"
 #include "move_gen.h"
+#include "hash_table.h"
+#include "util.h"
+#include "timer.h"
+#include "alloc.h"
+
+/* the key is stored xored with the data so that an entry which is
+ * written by two threads at once will fail the key comparison.
+ * 0-7 depth.
+ * 8-63 nodes.
+ */
+struct perft_entry {
+	uint64_t zobrist_key;
+	uint64_t data;
+};
+
+struct perft_table {
+	struct perft_entry *table;
+	uint64_t mask;
+	/* enum alloc_pages */
+	int pages;
+};
+
+struct perft_stats {
+	uint64_t probes;
+	uint64_t hits;
+};
+
+/* a work unit is a root move and, if the tree is split at depth 2,
+ * one of the replies to it.
+ */
+struct perft_unit {
+	int root;
+	move reply;
+	uint64_t nodes;
+};
+
+struct perft_work {
+	struct position *pos;
+	int depth;
+	int hash;
+	struct perft_stats stats;
+	move *root_list;
+	struct perft_unit *unit;
+	int units;
+	int next;
+	pthread_mutex_t mutex;
+};
+
+struct perft_table *perft_table = NULL;
+
+uint64_t perft_hash_white(struct position *pos, int depth, struct perft_stats *stats);
+uint64_t perft_hash_black(struct position *pos, int depth, struct perft_stats *stats);
 
 uint64_t perft(struct position *pos, int depth, int print, int verbose) {
 	return pos->turn ? perft_white(pos, depth, print, verbose) : perft_black(pos, depth, print, verbose);
 }
 
-uint64_t perft_white(struct position *pos, int depth, int print, int verbose) {
+/* us is 1 for white and 0 for black, always inlined into perft_white
+ * and perft_black so that the color is resolved at compile time.
+ */
+static ALWAYS_INLINE uint64_t perft_generic(struct position *pos, int depth, int print, int verbose, const int us) {
 	move move_list[256];
-	generate_white(pos, move_list);
+	struct undo u;
 	uint64_t nodes = 0, count;
 
+	/* bulk count the leaves */
+	if (depth == 1 && !verbose) {
+		PROFILE_CALL(PROFILE_MOVEGEN, nodes = us ? count_white(pos) : count_black(pos));
+		if (print)
+			printf("\nnodes: %" PRIu64 "\n", nodes);
+		return nodes;
+	}
+
+	PROFILE_CALL(PROFILE_MOVEGEN, us ? generate_white(pos, move_list) : generate_black(pos, move_list));
 	for (move *move_ptr = move_list; *move_ptr; move_ptr++){
 		if (depth == 1) {
 			count = 1;
 			nodes++;
 		}
 		else {
-			do_move(pos, move_ptr);
-			count = perft_black(pos, depth - 1, 0, 0);
-			undo_move(pos, move_ptr);
+			PROFILE_CALL(PROFILE_MAKEMOVE, do_move(pos, move_ptr, &u));
+			count = us ? perft_black(pos, depth - 1, 0, 0) : perft_white(pos, depth - 1, 0, 0);
+			PROFILE_CALL(PROFILE_MAKEMOVE, undo_move(pos, move_ptr, &u));
 			nodes += count;
 		}
 		if (verbose) {
@@ -54,28 +121,647 @@ uint64_t perft_white(struct position *pos, int depth, int print, int verbose) {
 	return nodes;
 }
 
+uint64_t perft_white(struct position *pos, int depth, int print, int verbose) {
+	return perft_generic(pos, depth, print, verbose, 1);
+}
+
 uint64_t perft_black(struct position *pos, int depth, int print, int verbose) {
+	return perft_generic(pos, depth, print, verbose, 0);
+}
+
+/* the perft table is separate from the search hash table, but has the
+ * same size.
+ */
+int perft_table_init() {
+	if (perft_table)
+		return 0;
+	uint64_t size = hash_table_size_bytes() / sizeof(struct perft_entry);
+	if (!size)
+		return 1;
+	/* round down to a power of 2 so that the index is a mask */
+	while (size & (size - 1))
+		size = clear_ls1b(size);
+
+	perft_table = malloc(sizeof(struct perft_table));
+	if (!perft_table)
+		return 1;
+	perft_table->table = alloc_large(size * sizeof(struct perft_entry), &perft_table->pages);
+	if (!perft_table->table) {
+		free(perft_table);
+		perft_table = NULL;
+		return 1;
+	}
+	perft_table->mask = size - 1;
+	return 0;
+}
+
+void perft_term() {
+	if (perft_table)
+		free_large(perft_table->table, (perft_table->mask + 1) * sizeof(struct perft_entry));
+	free(perft_table);
+	perft_table = NULL;
+}
+
+uint64_t perft_table_size_bytes() {
+	return perft_table ? (perft_table->mask + 1) * sizeof(struct perft_entry) : 0;
+}
+
+int perft_table_pages() {
+	return perft_table ? perft_table->pages : PAGES_NORMAL;
+}
+
+static inline struct perft_entry *perft_entry(struct position *pos) {
+	return perft_table->table + (pos->zobrist_key & perft_table->mask);
+}
+
+static ALWAYS_INLINE uint64_t perft_hash_generic(struct position *pos, int depth, struct perft_stats *stats, const int us) {
+	uint64_t nodes = 0;
+	if (depth == 1) {
+		PROFILE_CALL(PROFILE_MOVEGEN, nodes = us ? count_white(pos) : count_black(pos));
+		return nodes;
+	}
+
+	struct perft_entry *entry = perft_entry(pos);
+	uint64_t data = entry->data;
+	stats->probes++;
+	if ((entry->zobrist_key ^ data) == pos->zobrist_key && (data & 0xFF) == (uint64_t)depth) {
+		stats->hits++;
+		return data >> 8;
+	}
+
 	move move_list[256];
-	generate_black(pos, move_list);
+	struct undo u;
+	PROFILE_CALL(PROFILE_MOVEGEN, us ? generate_white(pos, move_list) : generate_black(pos, move_list));
+	for (move *move_ptr = move_list; *move_ptr; move_ptr++){
+		PROFILE_CALL(PROFILE_MAKEMOVE, do_move_zobrist(pos, move_ptr, &u));
+		nodes += us ? perft_hash_black(pos, depth - 1, stats) : perft_hash_white(pos, depth - 1, stats);
+		PROFILE_CALL(PROFILE_MAKEMOVE, undo_move_zobrist(pos, move_ptr, &u));
+	}
+
+	data = (nodes << 8) | depth;
+	entry->zobrist_key = pos->zobrist_key ^ data;
+	entry->data = data;
+	return nodes;
+}
+
+uint64_t perft_hash_white(struct position *pos, int depth, struct perft_stats *stats) {
+	return perft_hash_generic(pos, depth, stats, 1);
+}
+
+uint64_t perft_hash_black(struct position *pos, int depth, struct perft_stats *stats) {
+	return perft_hash_generic(pos, depth, stats, 0);
+}
+
+static inline uint64_t perft_hash_recursive(struct position *pos, int depth, struct perft_stats *stats) {
+	return pos->turn ? perft_hash_white(pos, depth, stats) : perft_hash_black(pos, depth, stats);
+}
+
+void perft_print_stats(struct perft_stats *stats) {
+	printf("hash hits: %" PRIu64 "/%" PRIu64 " (%.2f%%)\n", stats->hits, stats->probes,
+			stats->probes ? 100.0 * stats->hits / stats->probes : 0);
+}
+
+uint64_t perft_hash(struct position *pos, int depth, int print, int verbose) {
+	if (depth < 2 || perft_table_init())
+		return perft(pos, depth, print, verbose);
+
+	struct perft_stats stats = { 0 };
+	move move_list[256];
+	struct undo u;
+	generate_all(pos, move_list);
 	uint64_t nodes = 0, count;
 
 	for (move *move_ptr = move_list; *move_ptr; move_ptr++){
-		if (depth == 1) {
-			count = 1;
-			nodes++;
+		do_move_zobrist(pos, move_ptr, &u);
+		count = perft_hash_recursive(pos, depth - 1, &stats);
+		undo_move_zobrist(pos, move_ptr, &u);
+		nodes += count;
+		if (verbose) {
+			print_move(move_ptr);
+			printf(": %" PRIu64 "\n", count);
+		}
+	}
+	if (print) {
+		printf("\nnodes: %" PRIu64 "\n", nodes);
+		perft_print_stats(&stats);
+	}
+	return nodes;
+}
+
+void *perft_worker(void *arg) {
+	struct perft_work *work = arg;
+	struct position pos;
+	struct perft_stats stats = { 0 };
+	move m, reply;
+	struct undo u;
+	int i;
+
+	while (1) {
+		pthread_mutex_lock(&work->mutex);
+		i = work->next++;
+		pthread_mutex_unlock(&work->mutex);
+		if (i >= work->units)
+			break;
+
+		/* every unit starts from its own copy of the root position */
+		pos = *work->pos;
+		m = work->root_list[work->unit[i].root];
+		reply = work->unit[i].reply;
+		if (work->hash) {
+			do_move_zobrist(&pos, &m, &u);
+			if (reply)
+				do_move_zobrist(&pos, &reply, &u);
+			work->unit[i].nodes = perft_hash_recursive(&pos, work->depth - (reply ? 2 : 1), &stats);
 		}
 		else {
-			do_move(pos, move_ptr);
-			count = perft_white(pos, depth - 1, 0, 0);
-			undo_move(pos, move_ptr);
-			nodes += count;
+			do_move(&pos, &m, &u);
+			if (reply)
+				do_move(&pos, &reply, &u);
+			work->unit[i].nodes = perft(&pos, work->depth - (reply ? 2 : 1), 0, 0);
 		}
+	}
+
+	pthread_mutex_lock(&work->mutex);
+	work->stats.probes += stats.probes;
+	work->stats.hits += stats.hits;
+	pthread_mutex_unlock(&work->mutex);
+	return NULL;
+}
+
+uint64_t perft_threads(struct position *pos, int depth, int threads, int hash, int print, int verbose) {
+	if (hash && (depth < 3 || perft_table_init()))
+		hash = 0;
+	if (threads <= 1 || depth < 2)
+		return hash ? perft_hash(pos, depth, print, verbose) : perft(pos, depth, print, verbose);
+
+	struct perft_work work;
+	move root_list[256];
+	move move_list[256];
+	struct undo u;
+	uint64_t nodes = 0, count;
+	int i, j, n;
+
+	generate_all(pos, root_list);
+	n = move_count(root_list);
+
+	work.pos = pos;
+	work.depth = depth;
+	work.hash = hash;
+	work.stats.probes = 0;
+	work.stats.hits = 0;
+	work.root_list = root_list;
+	work.units = 0;
+	work.next = 0;
+	work.unit = malloc(256 * n * sizeof(struct perft_unit));
+	if (!work.unit)
+		return hash ? perft_hash(pos, depth, print, verbose) : perft(pos, depth, print, verbose);
+
+	/* split at depth 2 so that there are enough units to keep every
+	 * thread busy, root moves alone give a poor load balance.
+	 */
+	for (i = 0; i < n; i++) {
+		if (depth == 2) {
+			work.unit[work.units].root = i;
+			work.unit[work.units].reply = 0;
+			work.units++;
+			continue;
+		}
+		do_move(pos, root_list + i, &u);
+		generate_all(pos, move_list);
+		undo_move(pos, root_list + i, &u);
+		for (j = 0; move_list[j]; j++) {
+			work.unit[work.units].root = i;
+			work.unit[work.units].reply = move_list[j];
+			work.units++;
+		}
+	}
+
+	pthread_t *thread = malloc(threads * sizeof(pthread_t));
+	pthread_mutex_init(&work.mutex, NULL);
+	for (i = 0; thread && i < threads; i++)
+		if (pthread_create(thread + i, NULL, perft_worker, &work))
+			break;
+	/* no thread could be started */
+	if (!thread || !i)
+		perft_worker(&work);
+	for (j = 0; thread && j < i; j++)
+		pthread_join(thread[j], NULL);
+	pthread_mutex_destroy(&work.mutex);
+	free(thread);
+
+	for (i = 0, j = 0; i < n; i++) {
+		for (count = 0; j < work.units && work.unit[j].root == i; j++)
+			count += work.unit[j].nodes;
+		nodes += count;
 		if (verbose) {
-			print_move(move_ptr);
+			print_move(root_list + i);
 			printf(": %" PRIu64 "\n", count);
 		}
 	}
-	if (print)
+	free(work.unit);
+
+	if (print) {
 		printf("\nnodes: %" PRIu64 "\n", nodes);
+		if (hash)
+			perft_print_stats(&work.stats);
+	}
 	return nodes;
 }
+
+/* positions at the split depth, transpositions are merged and counted */
+struct perft_split_entry {
+	uint64_t count;
+	struct position pos;
+};
+
+struct perft_split {
+	struct perft_split_entry *entry;
+	uint64_t size;
+	uint64_t allocated;
+};
+
+/* a line of a units file.
+ * index count depth fen
+ */
+struct perft_unit_line {
+	uint64_t index;
+	uint64_t count;
+	int depth;
+	char fen[128];
+};
+
+int perft_split_collect(struct position *pos, int depth, struct perft_split *split) {
+	if (depth == 0) {
+		if (split->size == split->allocated) {
+			split->allocated = split->allocated ? 2 * split->allocated : 1024;
+			struct perft_split_entry *t = realloc(split->entry, split->allocated * sizeof(struct perft_split_entry));
+			if (!t)
+				return 1;
+			split->entry = t;
+		}
+		split->entry[split->size].count = 1;
+		split->entry[split->size].pos = *pos;
+		split->size++;
+		return 0;
+	}
+
+	move move_list[256];
+	struct undo u;
+	generate_all(pos, move_list);
+	for (move *move_ptr = move_list; *move_ptr; move_ptr++) {
+		do_move_zobrist(pos, move_ptr, &u);
+		int error = perft_split_collect(pos, depth - 1, split);
+		undo_move_zobrist(pos, move_ptr, &u);
+		if (error)
+			return 1;
+	}
+	return 0;
+}
+
+int perft_split_compare(const void *a, const void *b) {
+	uint64_t x = ((struct perft_split_entry *)a)->pos.zobrist_key;
+	uint64_t y = ((struct perft_split_entry *)b)->pos.zobrist_key;
+	return (x > y) - (x < y);
+}
+
+int perft_split(struct position *pos, int depth, int split_depth, char *path) {
+	struct perft_split split = { 0 };
+	char fen[128];
+	uint64_t i, j, paths = 0;
+
+	if (perft_split_collect(pos, split_depth, &split)) {
+		printf("error: out of memory\n");
+		free(split.entry);
+		return 1;
+	}
+
+	qsort(split.entry, split.size, sizeof(struct perft_split_entry), perft_split_compare);
+	for (i = 0, j = 0; i < split.size; i++) {
+		paths++;
+		if (j && split.entry[j - 1].pos.zobrist_key == split.entry[i].pos.zobrist_key)
+			split.entry[j - 1].count++;
+		else
+			split.entry[j++] = split.entry[i];
+	}
+	split.size = j;
+
+	FILE *f = fopen(path, "w");
+	if (!f) {
+		printf("error: could not open %s\n", path);
+		free(split.entry);
+		return 1;
+	}
+	fprintf(f, "# bitbit perft units\n");
+	fprintf(f, "# root %s\n", pos_to_fen(fen, pos));
+	fprintf(f, "# depth %i split %i paths %" PRIu64 " units %" PRIu64 "\n", depth, split_depth, paths, split.size);
+	for (i = 0; i < split.size; i++)
+		fprintf(f, "%" PRIu64 " %" PRIu64 " %i %s\n", i, split.entry[i].count,
+				depth - split_depth, pos_to_fen(fen, &split.entry[i].pos));
+	fclose(f);
+
+	printf("units: %" PRIu64 "\n", split.size);
+	free(split.entry);
+	return 0;
+}
+
+/* returns the number of units read, or -1 on error */
+int64_t perft_units_read(char *path, struct perft_unit_line **units) {
+	char line[BUFSIZ];
+	int64_t size = 0, allocated = 0;
+	int n;
+	*units = NULL;
+
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		printf("error: could not open %s\n", path);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+		if (size == allocated) {
+			allocated = allocated ? 2 * allocated : 1024;
+			struct perft_unit_line *t = realloc(*units, allocated * sizeof(struct perft_unit_line));
+			if (!t) {
+				printf("error: out of memory\n");
+				goto error;
+			}
+			*units = t;
+		}
+		struct perft_unit_line *unit = *units + size;
+		if (sscanf(line, "%" SCNu64 " %" SCNu64 " %i %n", &unit->index, &unit->count, &unit->depth, &n) < 3 ||
+				unit->index != (uint64_t)size || unit->depth < 1 ||
+				strlen(line + n) >= sizeof(unit->fen)) {
+			printf("error: bad unit in %s: %s", path, line);
+			goto error;
+		}
+		strcpy(unit->fen, line + n);
+		unit->fen[strcspn(unit->fen, "\n")] = '\0';
+		size++;
+	}
+	fclose(f);
+	return size;
+error:;
+	fclose(f);
+	free(*units);
+	*units = NULL;
+	return -1;
+}
+
+/* reads index nodes pairs into nodes, lines without a newline were cut
+ * short by an interrupted write and are skipped.
+ */
+int perft_results_read(char *path, uint64_t *nodes, int64_t size, int must_exist) {
+	char line[BUFSIZ];
+	uint64_t index, count;
+
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		if (must_exist)
+			printf("error: could not open %s\n", path);
+		return must_exist;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		if (!strchr(line, '\n'))
+			continue;
+		if (sscanf(line, "%" SCNu64 " %" SCNu64, &index, &count) != 2)
+			continue;
+		if (index >= (uint64_t)size) {
+			printf("error: unit %" PRIu64 " in %s does not exist\n", index, path);
+			fclose(f);
+			return 1;
+		}
+		if (nodes[index] != UINT64_MAX && nodes[index] != count) {
+			printf("error: inconsistent results for unit %" PRIu64 "\n", index);
+			fclose(f);
+			return 1;
+		}
+		nodes[index] = count;
+	}
+	fclose(f);
+	return 0;
+}
+
+int perft_unit_position(struct position *pos, struct perft_unit_line *unit) {
+	char fen[128];
+	char *argv[6];
+	int argc;
+	strcpy(fen, unit->fen);
+	argc = 0;
+	for (char *t = strtok(fen, " "); t && argc < 6; t = strtok(NULL, " "))
+		argv[argc++] = t;
+	if (!fen_is_ok(argc, argv))
+		return 1;
+	pos_from_fen(pos, argc, argv);
+	return 0;
+}
+
+int perft_run(char *units_path, char *results_path, int worker, int workers, int threads, int hash, int verbose) {
+	struct perft_unit_line *units;
+	struct position pos;
+	uint64_t *nodes = NULL;
+	int64_t size, i, done = 0, todo = 0;
+	char *tmp_path = NULL;
+	FILE *f = NULL;
+	int ret = 1;
+
+	if ((size = perft_units_read(units_path, &units)) < 0)
+		return 1;
+
+	nodes = malloc(size * sizeof(uint64_t));
+	if (!nodes) {
+		printf("error: out of memory\n");
+		goto end;
+	}
+	for (i = 0; i < size; i++)
+		nodes[i] = UINT64_MAX;
+
+	/* the results file is the checkpoint */
+	if (perft_results_read(results_path, nodes, size, 0))
+		goto end;
+
+	/* rewrite the checkpoint without a line that was cut short by an
+	 * interrupted write, it would otherwise be completed by the next
+	 * result.
+	 */
+	tmp_path = malloc(strlen(results_path) + 5);
+	if (!tmp_path) {
+		printf("error: out of memory\n");
+		goto end;
+	}
+	sprintf(tmp_path, "%s.tmp", results_path);
+	f = fopen(tmp_path, "w");
+	if (!f) {
+		printf("error: could not open %s\n", tmp_path);
+		goto end;
+	}
+	for (i = 0; i < size; i++)
+		if (nodes[i] != UINT64_MAX)
+			fprintf(f, "%" PRIi64 " %" PRIu64 "\n", i, nodes[i]);
+	if (fclose(f) || rename(tmp_path, results_path)) {
+		f = NULL;
+		printf("error: could not write %s\n", results_path);
+		goto end;
+	}
+	f = fopen(results_path, "a");
+	if (!f) {
+		printf("error: could not open %s\n", results_path);
+		goto end;
+	}
+
+	for (i = worker; i < size; i += workers) {
+		if (nodes[i] == UINT64_MAX)
+			todo++;
+		else
+			done++;
+	}
+
+	for (i = worker; i < size; i += workers) {
+		if (nodes[i] != UINT64_MAX)
+			continue;
+		if (perft_unit_position(&pos, units + i)) {
+			printf("error: bad fen for unit %" PRIi64 "\n", i);
+			goto end;
+		}
+		nodes[i] = perft_threads(&pos, units[i].depth, threads, hash, 0, 0);
+		fprintf(f, "%" PRIi64 " %" PRIu64 "\n", i, nodes[i]);
+		fflush(f);
+		done++;
+		todo--;
+		if (verbose)
+			printf("[%" PRIi64 "/%" PRIi64 "] unit %" PRIi64 ": %" PRIu64 "\n", done, done + todo, i, nodes[i]);
+	}
+	printf("units: %" PRIi64 "\n", done);
+	ret = 0;
+end:;
+	if (f)
+		fclose(f);
+	free(tmp_path);
+	free(nodes);
+	free(units);
+	return ret;
+}
+
+int perft_merge(char *units_path, int argc, char **argv) {
+	struct perft_unit_line *units;
+	uint64_t *nodes;
+	uint64_t total = 0;
+	int64_t size, i, missing = 0;
+	int ret = 1;
+
+	if ((size = perft_units_read(units_path, &units)) < 0)
+		return 1;
+
+	nodes = malloc(size * sizeof(uint64_t));
+	if (!nodes) {
+		printf("error: out of memory\n");
+		free(units);
+		return 1;
+	}
+	for (i = 0; i < size; i++)
+		nodes[i] = UINT64_MAX;
+
+	for (i = 0; i < argc; i++)
+		if (perft_results_read(argv[i], nodes, size, 1))
+			goto end;
+
+	for (i = 0; i < size; i++) {
+		if (nodes[i] == UINT64_MAX)
+			missing++;
+		else
+			total += units[i].count * nodes[i];
+	}
+
+	if (missing) {
+		printf("missing units: %" PRIi64 "/%" PRIi64 "\n", missing, size);
+		printf("partial nodes: %" PRIu64 "\n", total);
+	}
+	else {
+		printf("\nnodes: %" PRIu64 "\n", total);
+		ret = 0;
+	}
+end:;
+	free(nodes);
+	free(units);
+	return ret;
+}
+
+/* runs every position of an epd file with ;D1 20 ;D2 400 ... annotations,
+ * depths above max_depth are skipped unless max_depth is 0.
+ */
+int perft_suite(char *path, int max_depth, int threads, int hash, int verbose) {
+	char line[BUFSIZ];
+	char *argv[6];
+	int argc, depth, line_number = 0, positions = 0, passed = 0;
+	uint64_t expected, nodes, count, total_nodes = 0;
+	double t, time, total_time = 0;
+	struct position pos;
+
+	FILE *f = fopen(path, "r");
+	if (!f) {
+		printf("error: could not open %s\n", path);
+		return 1;
+	}
+
+	while (fgets(line, sizeof(line), f)) {
+		line_number++;
+		line[strcspn(line, "\r\n")] = '\0';
+		char *c = strchr(line, ';');
+		if (line[0] == '#' || strspn(line, " \t") == strlen(line))
+			continue;
+		if (!c) {
+			printf("error: no depths on line %i\n", line_number);
+			continue;
+		}
+		*c = '\0';
+
+		argc = 0;
+		for (char *token = strtok(line, " \t"); token && argc < 6; token = strtok(NULL, " \t"))
+			argv[argc++] = token;
+		if (!fen_is_ok(argc, argv)) {
+			printf("error: bad fen on line %i\n", line_number);
+			continue;
+		}
+		pos_from_fen(&pos, argc, argv);
+		positions++;
+
+		int pass = 1;
+		nodes = 0;
+		time = 0;
+		/* the fen has been tokenised, the depths start after the first ; */
+		for (c = strtok(c + 1, ";"); c; c = strtok(NULL, ";")) {
+			if (sscanf(c, " D%i %" SCNu64, &depth, &expected) != 2 || depth < 1) {
+				printf("error: bad depth on line %i: %s\n", line_number, c);
+				pass = 0;
+				continue;
+			}
+			if (max_depth && depth > max_depth)
+				continue;
+			t = wall_time();
+			count = perft_threads(&pos, depth, threads, hash, 0, 0);
+			t = wall_time() - t;
+			nodes += count;
+			time += t;
+			if (count != expected)
+				pass = 0;
+			if (verbose || count != expected)
+				printf("depth %i: %" PRIu64 " expected %" PRIu64 " %s\n", depth, count, expected,
+						count == expected ? "pass" : "fail");
+		}
+
+		passed += pass;
+		total_nodes += nodes;
+		total_time += time;
+		printf("[%i] %s nodes: %" PRIu64 " time: %.2f mnps: %.2f %s\n", positions, pass ? "pass" : "fail",
+				nodes, time, time ? nodes / (time * 1000000) : 0, pos_to_fen(line, &pos));
+	}
+	fclose(f);
+
+	printf("\npassed: %i/%i\n", passed, positions);
+	printf("nodes: %" PRIu64 "\n", total_nodes);
+	printf("time: %.2f\n", total_time);
+	printf("mnps: %.2f\n", total_time ? total_nodes / (total_time * 1000000) : 0);
+	return passed != positions;
+}
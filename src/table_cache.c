@@ -0,0 +1,180 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "table_cache.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "magic_bitboard.h"
+#include "hash_table.h"
+#include "move_gen.h"
+
+/* increase when the file format or the contents change */
+#define TABLE_CACHE_VERSION 3
+
+/* the sliding attack table and the zobrist keys follow the header,
+ * which is 64 bytes to keep the attack table cache aligned.
+ */
+struct table_header {
+	char id[8];
+	uint32_t version;
+	/* 1 if the attack table is indexed by pext */
+	uint32_t pext;
+	/* checksum of the magic numbers which give the table layout */
+	uint64_t layout;
+	uint64_t attacks_size;
+	uint64_t zobrist_size;
+	/* checksum of everything after the header */
+	uint64_t checksum;
+	uint64_t reserved[2];
+};
+
+static const char table_id[8] = "bitbit";
+
+static void *table_map = NULL;
+static size_t table_map_size = 0;
+
+uint64_t table_checksum(uint64_t h, const uint64_t *data, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		h ^= data[i];
+		h *= 0x100000001B3;
+		h ^= h >> 29;
+	}
+	return h;
+}
+
+void table_header_init(struct table_header *header) {
+	memset(header, 0, sizeof(*header));
+	memcpy(header->id, table_id, sizeof(table_id));
+	header->version = TABLE_CACHE_VERSION;
+	header->pext = move_gen_pext();
+	header->layout = 0xCBF29CE484222325;
+#ifndef BMI2
+	header->layout = table_checksum(header->layout, bishop_magic_number, 64);
+	header->layout = table_checksum(header->layout, rook_magic_number, 64);
+#endif
+	header->attacks_size = SLIDING_ATTACKS_SIZE;
+	header->zobrist_size = ZOBRIST_KEYS;
+}
+
+void table_cache_init() {
+	struct table_header expected;
+	const struct table_header *header;
+	struct stat st;
+	char *path = getenv("BITBIT_TABLES");
+	if (!path)
+		return;
+
+	table_header_init(&expected);
+	size_t size = sizeof(expected) + (expected.attacks_size + expected.zobrist_size) * sizeof(uint64_t);
+
+	/* a missing or stale file is written again by table_cache_store */
+	int fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return;
+	if (fstat(fd, &st) || (size_t)st.st_size != size) {
+		close(fd);
+		return;
+	}
+	void *map = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return;
+
+	header = map;
+	if (memcmp(header->id, expected.id, sizeof(expected.id)) ||
+			header->version != expected.version ||
+			header->pext != expected.pext ||
+			header->layout != expected.layout ||
+			header->attacks_size != expected.attacks_size ||
+			header->zobrist_size != expected.zobrist_size ||
+			header->checksum != table_checksum(0, (uint64_t *)(header + 1),
+				expected.attacks_size + expected.zobrist_size)) {
+		munmap(map, size);
+		return;
+	}
+	table_map = map;
+	table_map_size = size;
+}
+
+int table_cache_store() {
+	struct table_header header;
+	char *path = getenv("BITBIT_TABLES");
+	if (!path || table_map)
+		return 0;
+
+	table_header_init(&header);
+	header.checksum = table_checksum(0, sliding_attacks_lookup, header.attacks_size);
+	header.checksum = table_checksum(header.checksum, hash_table->zobrist_key, header.zobrist_size);
+
+	/* other processes may be starting at the same time, the file is
+	 * replaced at once by rename so that they never map a partial file.
+	 */
+	char *tmp_path = malloc(strlen(path) + 32);
+	if (!tmp_path) {
+		printf("error: out of memory\n");
+		return 1;
+	}
+	sprintf(tmp_path, "%s.%ld.tmp", path, (long)getpid());
+	FILE *f = fopen(tmp_path, "wb");
+	if (!f) {
+		printf("error: could not open %s\n", tmp_path);
+		free(tmp_path);
+		return 1;
+	}
+	int error = fwrite(&header, sizeof(header), 1, f) != 1 ||
+		fwrite(sliding_attacks_lookup, sizeof(uint64_t), header.attacks_size, f) != header.attacks_size ||
+		fwrite(hash_table->zobrist_key, sizeof(uint64_t), header.zobrist_size, f) != header.zobrist_size;
+	if (fclose(f) || error || rename(tmp_path, path)) {
+		printf("error: could not write %s\n", path);
+		remove(tmp_path);
+		free(tmp_path);
+		return 1;
+	}
+	free(tmp_path);
+	return 0;
+}
+
+void table_cache_term() {
+	if (table_map)
+		munmap(table_map, table_map_size);
+	table_map = NULL;
+}
+
+int table_cache_mapped() {
+	return table_map != NULL;
+}
+
+const uint64_t *table_cache_attacks() {
+	if (!table_map)
+		return NULL;
+	return (const uint64_t *)((const struct table_header *)table_map + 1);
+}
+
+const uint64_t *table_cache_zobrist() {
+	if (!table_map)
+		return NULL;
+	return table_cache_attacks() + SLIDING_ATTACKS_SIZE;
+}
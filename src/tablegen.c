@@ -0,0 +1,270 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* tablegen writes the constant lookup tables as c source. It runs on
+ * the build machine before bitbit is compiled, see the Makefile. The
+ * sliding piece attack tables are not generated here since their
+ * layout depends on the move generation kernel selected at startup.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "bitboard.h"
+
+int piece_value[6] = { 100, 300, 315, 500, 900, 0 };
+
+int white_side_eval_table[6][64] = {
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		 50,  50,  50,  50,  50,  50,  50,  50,
+		 10,  10,  20,  30,  30,  20,  10,  10,
+		  5,   5,  10,  25,  25,  10,   5,   5,
+		  0,   0,   0,  20,  20,   0,   0,   0,
+		  5,  -5, -10,   0,   0, -10,  -5,   5,
+		  5,  10,  10, -20, -20,  10,  10,   5,
+		  0,   0,   0,   0,   0,   0,   0,   0
+	}, {
+		-50, -40, -30, -30, -30, -30, -40, -50,
+		-40, -20,   0,   0,   0,   0, -20, -40,
+		-30,   0,  10,  15,  15,  10,   0, -30,
+		-30,   5,  15,  20,  20,  15,   5, -30,
+		-30,   0,  15,  20,  20,  15,   0, -30,
+		-30,   5,  10,  15,  15,  10,   5, -30,
+		-40, -20,   0,   5,   5,   0, -20, -40,
+		-50, -40, -30, -30, -30, -30, -40, -50
+	}, {
+		-20, -10, -10, -10, -10, -10, -10, -20,
+		-10,   0,   0,   0,   0,   0,   0, -10,
+		-10,   0,   5,  10,  10,   5,   0, -10,
+		-10,   5,   5,  10,  10,   5,   5, -10,
+		-10,   0,  10,  10,  10,  10,   0, -10,
+		-10,  10,  10,  10,  10,  10,  10, -10,
+		-10,   5,   0,   0,   0,   0,   5, -10,
+		-20, -10, -10, -10, -10, -10, -10, -20
+	}, {
+		  0,   0,   0,   0,   0,   0,   0,   0,
+		  5,  10,  10,  10,  10,  10,  10,   5,
+		 -5,   0,   0,   0,   0,   0,   0,  -5,
+		 -5,   0,   0,   0,   0,   0,   0,  -5,
+		 -5,   0,   0,   0,   0,   0,   0,  -5,
+		 -5,   0,   0,   0,   0,   0,   0,  -5,
+		 -5,   0,   0,   0,   0,   0,   0,  -5,
+		  0,   0,   0,   5,   5,   0,   0,   0
+	}, {
+		-20, -10, -10,  -5,  -5, -10, -10, -20,
+		-10,   0,   0,   0,   0,   0,   0, -10,
+		-10,   0,   5,   5,   5,   5,   0, -10,
+		 -5,   0,   5,   5,   5,   5,   0,  -5,
+		  0,   0,   5,   5,   5,   5,   0,  -5,
+		-10,   5,   5,   5,   5,   5,   0, -10,
+		-10,   0,   5,   0,   0,   0,   0, -10,
+		-20, -10, -10,  -5,  -5, -10, -10, -20
+	}, {
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-30, -40, -40, -50, -50, -40, -40, -30,
+		-20, -30, -30, -40, -40, -30, -30, -20,
+		-10, -20, -20, -20, -20, -20, -20, -10,
+		 20,  20,   0,   0,   0,   0,  20,  20,
+		 20,  30,  10,   0,   0,  10,  30,  20
+	}
+
+};
+
+uint64_t knight_attacks[64];
+uint64_t king_attacks[64];
+uint64_t between[64 * 64];
+uint64_t line[64 * 64];
+int castle_table[64];
+int eval_table[13][64];
+
+/* the square dx files and dy ranks away, or 0 if it is off the board */
+uint64_t step(int square, int dx, int dy) {
+	int x = square % 8 + dx;
+	int y = square / 8 + dy;
+	if (x < 0 || x > 7 || y < 0 || y > 7)
+		return 0;
+	return bitboard(x + 8 * y);
+}
+
+/* the squares from square in the direction dx, dy up to and including
+ * the first square in b.
+ */
+uint64_t ray(int square, int dx, int dy, uint64_t b) {
+	uint64_t attacks = 0;
+	uint64_t s;
+	for (int i = 1; (s = step(square, i * dx, i * dy)); i++) {
+		attacks |= s;
+		if (b & s)
+			break;
+	}
+	return attacks;
+}
+
+uint64_t bishop_attacks_calc(int square, uint64_t b) {
+	return ray(square, 1, 1, b) | ray(square, -1, 1, b) |
+	       ray(square, 1, -1, b) | ray(square, -1, -1, b);
+}
+
+uint64_t rook_attacks_calc(int square, uint64_t b) {
+	return ray(square, 1, 0, b) | ray(square, -1, 0, b) |
+	       ray(square, 0, 1, b) | ray(square, 0, -1, b);
+}
+
+uint64_t knight_attacks_calc(int square) {
+	return step(square, 2, 1) | step(square, 1, 2) |
+	       step(square, -1, 2) | step(square, -2, 1) |
+	       step(square, -2, -1) | step(square, -1, -2) |
+	       step(square, 1, -2) | step(square, 2, -1);
+}
+
+uint64_t king_attacks_calc(int square) {
+	return step(square, 1, 0) | step(square, 1, 1) |
+	       step(square, 0, 1) | step(square, -1, 1) |
+	       step(square, -1, 0) | step(square, -1, -1) |
+	       step(square, 0, -1) | step(square, 1, -1);
+}
+
+uint64_t between_calc(int x, int y) {
+	int a_x = x % 8;
+	int b_x = x / 8;
+	int a_y = y % 8;
+	int b_y = y / 8;
+	if (a_x == a_y || b_x == b_y) {
+		return rook_attacks_calc(x, bitboard(y)) & rook_attacks_calc(y, bitboard(x));
+	}
+	else if (a_x - a_y == b_x - b_y || a_x - a_y == b_y - b_x) {
+		return bishop_attacks_calc(x, bitboard(y)) & bishop_attacks_calc(y, bitboard(x));
+	}
+	return 0;
+}
+
+uint64_t line_calc(int x, int y) {
+	if (x % 8 == y % 8 || x / 8 == y / 8) {
+		return rook_attacks_calc(x, 0) & rook_attacks_calc(y, 0);
+	}
+	else {
+		return bishop_attacks_calc(x, 0) & bishop_attacks_calc(y, 0);
+	}
+}
+
+/* the castling rights which are kept when a piece moves from or to
+ * square, the king and rook starting squares clear theirs.
+ */
+int castle_calc(int square) {
+	int castle = 0xF;
+	if (square == 0) {
+		castle = clear_bit(castle, 1);
+	}
+	else if (square == 4) {
+		castle = clear_bit(castle, 0);
+		castle = clear_bit(castle, 1);
+	}
+	else if (square == 7) {
+		castle = clear_bit(castle, 0);
+	}
+	else if (square == 56) {
+		castle = clear_bit(castle, 3);
+	}
+	else if (square == 60) {
+		castle = clear_bit(castle, 2);
+		castle = clear_bit(castle, 3);
+	}
+	else if (square == 63) {
+		castle = clear_bit(castle, 2);
+	}
+	return castle;
+}
+
+int eval_calc(int piece, int square) {
+	if (piece == 0)
+		return 0;
+	else if (piece < 7)
+		return white_side_eval_table[piece - 1][(7 - square / 8) * 8 + (square % 8)] +
+		       piece_value[piece - 1];
+	else
+		return -white_side_eval_table[piece - 7][square] -
+		       piece_value[piece - 7];
+}
+
+void print_uint64(FILE *f, const char *name, const uint64_t *table, int size) {
+	fprintf(f, "\nconst uint64_t %s[%i] = {\n", name, size);
+	for (int i = 0; i < size; i++)
+		fprintf(f, "%s0x%016" PRIX64 ",%s", i % 4 ? " " : "\t", table[i], i % 4 == 3 ? "\n" : "");
+	fprintf(f, "};\n");
+}
+
+void print_int(FILE *f, const char *type, const char *name, const int *table, int size) {
+	fprintf(f, "\nconst %s %s[%i] = {\n", type, name, size);
+	for (int i = 0; i < size; i++)
+		fprintf(f, "%s%i,%s", i % 16 ? " " : "\t", table[i], i % 16 == 15 ? "\n" : "");
+	fprintf(f, "};\n");
+}
+
+int main(int argc, char **argv) {
+	if (argc != 2) {
+		fprintf(stderr, "usage: %s file\n", argv[0]);
+		return 1;
+	}
+
+	for (int square = 0; square < 64; square++) {
+		knight_attacks[square] = knight_attacks_calc(square);
+		king_attacks[square] = king_attacks_calc(square);
+	}
+	for (int i = 0; i < 64; i++) {
+		for (int j = 0; j < 64; j++) {
+			between[i + 64 * j] = between_calc(i, j);
+			line[i + 64 * j] = line_calc(i, j);
+		}
+	}
+	for (int square = 0; square < 64; square++)
+		castle_table[square] = castle_calc(square);
+	for (int piece = 0; piece < 13; piece++)
+		for (int square = 0; square < 64; square++)
+			eval_table[piece][square] = eval_calc(piece, square);
+
+	FILE *f = fopen(argv[1], "w");
+	if (!f) {
+		fprintf(stderr, "error: could not open %s\n", argv[1]);
+		return 1;
+	}
+	fprintf(f, "/* generated by tablegen, do not edit */\n\n");
+	fprintf(f, "#include \"attack_gen.h\"\n");
+	fprintf(f, "#include \"bitboard.h\"\n");
+	fprintf(f, "#include \"evaluate.h\"\n");
+	print_uint64(f, "knight_attacks_lookup", knight_attacks, 64);
+	print_uint64(f, "king_attacks_lookup", king_attacks, 64);
+	print_uint64(f, "between_lookup", between, 64 * 64);
+	print_uint64(f, "line_lookup", line, 64 * 64);
+	print_int(f, "uint8_t", "castle_lookup", castle_table, 64);
+	fprintf(f, "\nconst int16_t eval_table[13][64] = {\n");
+	for (int piece = 0; piece < 13; piece++) {
+		fprintf(f, "\t{\n");
+		for (int square = 0; square < 64; square++)
+			fprintf(f, "%s%i,%s", square % 8 ? " " : "\t\t", eval_table[piece][square], square % 8 == 7 ? "\n" : "");
+		fprintf(f, "\t},\n");
+	}
+	fprintf(f, "};\n");
+	if (fclose(f)) {
+		fprintf(stderr, "error: could not write %s\n", argv[1]);
+		return 1;
+	}
+	return 0;
+}
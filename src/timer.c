@@ -0,0 +1,88 @@
+/* bitbit, a bitboard based chess engine written in c.
+ * Copyright (C) 2022 Isak Ellmer
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+#include "timer.h"
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <time.h>
+
+uint64_t profile_ns[PROFILE_TIMERS];
+uint64_t profile_calls[PROFILE_TIMERS];
+
+char *profile_name[PROFILE_TIMERS] = { "movegen", "makemove", "evaluate", };
+
+/* monotonic wall clock time, clock() adds up the time of all threads */
+uint64_t time_ns() {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+double wall_time() {
+	return (double)time_ns() / 1000000000;
+}
+
+/* the timers are shared by all threads */
+void profile_add(enum profile_timer timer, uint64_t ns) {
+	__atomic_fetch_add(profile_ns + timer, ns, __ATOMIC_RELAXED);
+	__atomic_fetch_add(profile_calls + timer, 1, __ATOMIC_RELAXED);
+}
+
+void profile_reset() {
+	for (int i = 0; i < PROFILE_TIMERS; i++) {
+		profile_ns[i] = 0;
+		profile_calls[i] = 0;
+	}
+}
+
+static inline uint64_t nps(uint64_t nodes, uint64_t ns) {
+	return ns ? (uint64_t)((double)nodes * 1000000000 / ns) : 0;
+}
+
+void timer_print(int format, char *name, int depth, uint64_t nodes, uint64_t ns) {
+	if (format == TIMER_MACHINE)
+		printf("%s depth=%i nodes=%" PRIu64 " time_ns=%" PRIu64 " nps=%" PRIu64 "\n",
+				name, depth, nodes, ns, nps(nodes, ns));
+	else
+		printf("depth %2i nodes %12" PRIu64 " time %10.6f mnps %8.2f\n",
+				depth, nodes, (double)ns / 1000000000, (double)nps(nodes, ns) / 1000000);
+}
+
+/* ns is the total time the timed threads have run, the share of
+ * the rest is time spent in the search itself.
+ */
+void profile_print(int format, uint64_t ns) {
+#ifdef PROFILE
+	for (int i = 0; i < PROFILE_TIMERS; i++) {
+		if (!profile_calls[i])
+			continue;
+		if (format == TIMER_MACHINE)
+			printf("profile name=%s calls=%" PRIu64 " time_ns=%" PRIu64 "\n",
+					profile_name[i], profile_calls[i], profile_ns[i]);
+		else
+			printf("%-8s calls %12" PRIu64 " time %10.6f ns/call %7.2f share %6.2f%%\n",
+					profile_name[i], profile_calls[i], (double)profile_ns[i] / 1000000000,
+					(double)profile_ns[i] / profile_calls[i],
+					ns ? 100 * (double)profile_ns[i] / ns : 0);
+	}
+#else
+	(void)format;
+	(void)ns;
+#endif
+}
@@ -19,21 +19,59 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 
 #include "init.h"
 
-uint64_t rand_uint64() {
-	uint64_t ret = 0;
-	for (int i = 0; i < 4; i++) {
-		ret ^= (uint64_t)(rand() & 0xFFFF) << 16 * i;
-	}
+struct rand_state main_rand;
+
+static inline uint64_t rotl(uint64_t x, int k) {
+	return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t splitmix64(uint64_t *x) {
+	uint64_t z = (*x += 0x9E3779B97F4A7C15);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+	return z ^ (z >> 31);
+}
+
+void rand_seed(struct rand_state *state, uint64_t seed) {
+	/* splitmix64 never gives four zero words */
+	for (int i = 0; i < 4; i++)
+		state->s[i] = splitmix64(&seed);
+}
+
+uint64_t rand_next(struct rand_state *state) {
+	uint64_t *s = state->s;
+	uint64_t ret = rotl(s[1] * 5, 7) * 9;
+	uint64_t t = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = rotl(s[3], 45);
 	return ret;
 }
 
-/* results not completely uniform */
+uint64_t rand_below(struct rand_state *state, uint64_t n) {
+	/* the first 2^64 mod n values would make the low results more
+	 * likely, reject them.
+	 */
+	uint64_t threshold = -n % n;
+	uint64_t r;
+	do {
+		r = rand_next(state);
+	} while (r < threshold);
+	return r % n;
+}
+
+uint64_t rand_uint64() {
+	return rand_next(&main_rand);
+}
+
 int rand_int(int i) {
-	return rand() % i;
+	return rand_below(&main_rand, i);
 }
 
 int power(int m, int n) {
@@ -56,6 +94,52 @@ int string_is_int(char *s) {
 	return 1;
 }
 
+/* a number of bytes with an optional K, M or G suffix, 0 if the string
+ * is not a size.
+ */
+uint64_t string_to_bytes(char *t) {
+	int i;
+	int flag;
+	uint64_t size;
+	for (size = 0, flag = 0, i = 0; t[i] != '\0'; i++) {
+		switch (t[i]) {
+		case 'G':
+			size *= 1024;
+			/* fallthrough */
+		case 'M':
+			size *= 1024;
+			/* fallthrough */
+		case 'K':
+			size *= 1024;
+			if (!flag) {
+				flag = 1;
+				break;
+			}
+			/* fallthrough */
+		case '0':
+		case '1':
+		case '2':
+		case '3':
+		case '4':
+		case '5':
+		case '6':
+		case '7':
+		case '8':
+		case '9':
+			if (!flag) {
+				size *= 10;
+				/* will return 0 anyway if t[i] is K, M, G */
+				size += find_char("0123456789", t[i]);
+				break;
+			}
+			/* fallthrough */
+		default:
+			return 0;
+		}
+	}
+	return size;
+}
+
 void merge_sort(move *arr, int16_t *val, unsigned int first, unsigned int last, int increasing) {
 	if (first < last) {
 		unsigned int middle = (first + last) / 2;
@@ -76,8 +160,11 @@ void merge(move *arr, int16_t *val, unsigned int first, unsigned int last, int i
 	unsigned int i = first, j = middle + 1, k = 0;
 
 	while (i <= middle && j <= last) {
-		/* xnor */
-		if ((val[i] <= val[j]) == increasing) {
+		/* stable, equal values keep their order. The root search
+		 * relies on it, a move which fails low with the best
+		 * evaluation so far must stay behind the move which has it.
+		 */
+		if (increasing ? val[i] <= val[j] : val[i] >= val[j]) {
 			temp_arr[k] = arr[i];
 			temp_val[k] = val[i];
 			i++;
@@ -114,6 +201,6 @@ void merge(move *arr, int16_t *val, unsigned int first, unsigned int last, int i
 }
 
 void util_init() {
-	srand(0);
+	rand_seed(&main_rand, 0);
 	init_status("setting seed");
 }